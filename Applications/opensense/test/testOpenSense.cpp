@@ -54,6 +54,30 @@ int main()
     facingX.setName("calibrated_FacingX");
     facingX.finalizeFromProperties();
 
+    // Averaging the orientations over the standing trial should give nearly
+    // the same IMU offsets as the first frame.
+    IMUPlacer placerXAveraged("imuPlacerFaceX.xml");
+    placerXAveraged.set_calibration_window_size(200);
+    placerXAveraged.run(false);
+    const Model& facingXAveraged = placerXAveraged.getCalibratedModel();
+    for (const auto& averagedOffset :
+            facingXAveraged.getComponentList<PhysicalOffsetFrame>()) {
+        const std::string& name = averagedOffset.getName();
+        if (name.size() < 4 || name.substr(name.size() - 4) != "_imu") {
+            continue;
+        }
+        const auto& offset = facingX.getComponent<PhysicalOffsetFrame>(
+                averagedOffset.getAbsolutePathString());
+        const SimTK::Rotation difference =
+                ~offset.getOffsetTransform().R() *
+                averagedOffset.getOffsetTransform().R();
+        // Less than 5 degrees.
+        ASSERT(difference.convertRotationToAngleAxis()[0] < SimTK::Pi / 36,
+                __FILE__, __LINE__,
+                "Averaged calibration of " + name +
+                        " differed from the first frame.");
+    }
+
     IMUInverseKinematicsTool ik_hjc("setup_IMUInverseKinematics_HJC_trial.xml");
     ik_hjc.setModel(facingX);
     ik_hjc.set_results_directory("ik_hjc_" + facingX.getName());
@@ -11,6 +11,8 @@
 %include <OpenSim/Common/About.h>
 %include <OpenSim/Common/Exception.h>
 
+%ignore OpenSim::parallelFor;
+%ignore OpenSim::ThreadPool;
 %include <OpenSim/Common/CommonUtilities.h>
 
 %shared_ptr(OpenSim::LogSink);
@@ -122,6 +122,7 @@ EXPOSE_BOUNDS_CONSTRUCTORS_HELPER(MocoFinalBounds);
 
 %include <OpenSim/Moco/MocoTrajectory.h>
 
+%ignore OpenSim::MocoSolver::releaseProblemRepJar;
 %include <OpenSim/Moco/MocoSolver.h>
 %include <OpenSim/Moco/MocoDirectCollocationSolver.h>
 
@@ -136,6 +137,7 @@ namespace OpenSim {
 
 %include <OpenSim/Moco/MocoTool.h>
 %include <OpenSim/Moco/MocoInverse.h>
+%include <OpenSim/Moco/MocoInverseOnline.h>
 %include <OpenSim/Moco/MocoTrack.h>
 
 %include <OpenSim/Moco/MocoUtilities.h>
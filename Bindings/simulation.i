@@ -243,6 +243,10 @@ OpenSim::ModelComponentSet<OpenSim::Controller>;
 %include <OpenSim/Simulation/OpenSense/IMUPlacer.h>
 %include <OpenSim/Simulation/OpenSense/IMU.h>
 
+// Moving from a table would empty the caller's table.
+%ignore OpenSim::CompactOrientationsTable::CompactOrientationsTable(
+        TimeSeriesTableQuaternion&&);
+%include <OpenSim/Simulation/OpenSense/CompactOrientationsTable.h>
 %include <OpenSim/Simulation/OpenSense/OpenSenseUtilities.h>
 
 %template(StdVectorIMUs) std::vector< OpenSim::IMU* >;
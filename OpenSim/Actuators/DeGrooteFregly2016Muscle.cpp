@@ -83,6 +83,13 @@ void DeGrooteFregly2016Muscle::constructProperties() {
 
 void DeGrooteFregly2016Muscle::extendFinalizeFromProperties() {
     Super::extendFinalizeFromProperties();
+    checkPropertyValues();
+    calcDerivedQuantities();
+    m_isTendonDynamicsExplicit =
+            get_tendon_compliance_dynamics_mode() == "explicit";
+}
+
+void DeGrooteFregly2016Muscle::checkPropertyValues() const {
     OPENSIM_THROW_IF_FRMOBJ(!getProperty_optimal_force().getValueIsDefault(),
             Exception,
             "The optimal_force property is ignored for this Force; "
@@ -151,7 +158,15 @@ void DeGrooteFregly2016Muscle::extendFinalizeFromProperties() {
             getProperty_pennation_angle_at_optimal().getName(),
             "Pennation angle at optimal fiber length must be in the range [0, "
             "Pi/2).");
+}
 
+void DeGrooteFregly2016Muscle::updateDerivedQuantitiesFromProperties() {
+    checkPropertyValues();
+    updateMuscleQuantitiesFromProperties();
+    calcDerivedQuantities();
+}
+
+void DeGrooteFregly2016Muscle::calcDerivedQuantities() {
     using SimTK::square;
     const auto normFiberWidth = sin(get_pennation_angle_at_optimal());
     m_fiberWidth = get_optimal_fiber_length() * normFiberWidth;
@@ -160,8 +175,6 @@ void DeGrooteFregly2016Muscle::extendFinalizeFromProperties() {
             get_max_contraction_velocity() * get_optimal_fiber_length();
     m_kT = log((1.0 + c3) / c1) /
            (1.0 + get_tendon_strain_at_one_norm_force() - c2);
-    m_isTendonDynamicsExplicit =
-            get_tendon_compliance_dynamics_mode() == "explicit";
 }
 
 void DeGrooteFregly2016Muscle::extendAddToSystem(
@@ -797,6 +797,19 @@ public:
             Model& model, bool allowUnsupportedMuscles = false);
     /// @}
 
+    /// @name Parameter updates
+    /// @{
+    /// Recompute the quantities this muscle derives from its scalar
+    /// properties (e.g., fiber width, tendon stiffness), including those
+    /// cached by Muscle (e.g., max isometric force, optimal fiber length),
+    /// after one of those properties has been edited, without re-finalizing
+    /// the muscle or rebuilding the System. The property values are checked
+    /// as in finalizeFromProperties(). None of these properties affect the
+    /// muscle's state variables, so the System's topology is unchanged.
+    /// MocoParameter uses this to apply parameter values in place.
+    void updateDerivedQuantitiesFromProperties();
+    /// @}
+
     /// @name Scaling
     /// @{
     /// Adjust the properties of the muscle after the model has been scaled. The
@@ -808,6 +821,10 @@ public:
 
 private:
     void constructProperties();
+    /// Throw if a property value is invalid.
+    void checkPropertyValues() const;
+    /// Compute the quantities this muscle derives from its properties.
+    void calcDerivedQuantities();
 
     void calcMuscleLengthInfoHelper(const SimTK::Real& muscleTendonLength,
             const bool& ignoreTendonCompliance, MuscleLengthInfo& mli,
@@ -143,13 +143,25 @@ public:
     /// The ExternalLoads XML file is located relative to `relativeToDirectory`.
     void operate(Model& model,
             const std::string& relativeToDirectory) const override {
+        model.addModelComponent(
+                new ExternalLoads(getPath(relativeToDirectory), true));
+    }
+    /// The ExternalLoads data file is read when the model is connected, not
+    /// by this operator, so only the XML file is listed.
+    std::vector<std::string> getInputFilePaths(
+            const std::string& relativeToDirectory) const override {
+        return {getPath(relativeToDirectory)};
+    }
+
+private:
+    std::string getPath(const std::string& relativeToDirectory) const {
         std::string path = get_filepath();
         if (!relativeToDirectory.empty()) {
             using SimTK::Pathname;
             path = Pathname::getAbsolutePathnameUsingSpecifiedWorkingDirectory(
                     relativeToDirectory, path);
         }
-        model.addModelComponent(new ExternalLoads(path, true));
+        return path;
     }
 };
 
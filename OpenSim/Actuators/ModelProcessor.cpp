@@ -0,0 +1,143 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: ModelProcessor.cpp                                                *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2020 Stanford University and the Authors                     *
+ *                                                                            *
+ * Author(s): Christopher Dembia                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+
+#include "ModelProcessor.h"
+
+#include <OpenSim/Common/CommonUtilities.h>
+
+#include <mutex>
+#include <unordered_map>
+
+using namespace OpenSim;
+
+namespace {
+struct ModelMemo {
+    std::mutex mutex;
+    bool enabled = false;
+    std::unordered_map<std::uint64_t, Model> models;
+};
+ModelMemo& getModelMemo() {
+    static ModelMemo memo;
+    return memo;
+}
+} // anonymous namespace
+
+void ModelProcessor::setMemoizationEnabled(bool enabled) {
+    auto& memo = getModelMemo();
+    std::lock_guard<std::mutex> lock(memo.mutex);
+    memo.enabled = enabled;
+}
+
+bool ModelProcessor::getMemoizationEnabled() {
+    auto& memo = getModelMemo();
+    std::lock_guard<std::mutex> lock(memo.mutex);
+    return memo.enabled;
+}
+
+void ModelProcessor::clearMemoizedModels() {
+    auto& memo = getModelMemo();
+    std::lock_guard<std::mutex> lock(memo.mutex);
+    memo.models.clear();
+}
+
+std::string ModelProcessor::getSourcePath(
+        const std::string& relativeToDirectory) const {
+    std::string path;
+    if (get_filepath().empty()) {
+        OPENSIM_THROW_IF_FRMOBJ(getProperty_model().empty(), Exception,
+                "No source model.");
+    } else {
+        OPENSIM_THROW_IF_FRMOBJ(!getProperty_model().empty(), Exception,
+                "Expected either a Model object or a filepath, but "
+                "both were provided.");
+        path = get_filepath();
+        if (!relativeToDirectory.empty()) {
+            using SimTK::Pathname;
+            path = Pathname::getAbsolutePathnameUsingSpecifiedWorkingDirectory(
+                    relativeToDirectory, path);
+        }
+    }
+    return path;
+}
+
+Model ModelProcessor::process(const std::string& relativeToDirectory) const {
+    const std::string path = getSourcePath(relativeToDirectory);
+
+    if (!getMemoizationEnabled()) {
+        return processWithoutMemoization(path, relativeToDirectory);
+    }
+
+    auto& memo = getModelMemo();
+    const std::uint64_t key = computeMemoizationKey(path, relativeToDirectory);
+    {
+        std::lock_guard<std::mutex> lock(memo.mutex);
+        const auto it = memo.models.find(key);
+        if (it != memo.models.end()) return it->second;
+    }
+    Model model = processWithoutMemoization(path, relativeToDirectory);
+    std::lock_guard<std::mutex> lock(memo.mutex);
+    memo.models.emplace(key, model);
+    return model;
+}
+
+Model ModelProcessor::processWithoutMemoization(const std::string& sourcePath,
+        const std::string& relativeToDirectory) const {
+    Model model;
+    if (sourcePath.empty()) {
+        model = get_model();
+    } else {
+        Model modelFromFile(sourcePath);
+        model = std::move(modelFromFile);
+        model.finalizeFromProperties();
+        model.finalizeConnections();
+    }
+
+    for (int i = 0; i < getProperty_operators().size(); ++i) {
+        get_operators(i).operate(model, relativeToDirectory);
+    }
+    return model;
+}
+
+std::uint64_t ModelProcessor::computeContentKey(
+        const std::string& relativeToDirectory) const {
+    return computeMemoizationKey(
+            getSourcePath(relativeToDirectory), relativeToDirectory);
+}
+
+std::uint64_t ModelProcessor::computeMemoizationKey(
+        const std::string& sourcePath,
+        const std::string& relativeToDirectory) const {
+    std::uint64_t key;
+    if (sourcePath.empty()) {
+        key = computeContentHash(get_model().dump());
+    } else {
+        // The path is part of the key since the model may refer to other
+        // files relative to its own location.
+        key = computeContentHash(sourcePath);
+        key = computeFileContentHash(sourcePath, key);
+    }
+    for (int i = 0; i < getProperty_operators().size(); ++i) {
+        const auto& op = get_operators(i);
+        key = computeContentHash(op.dump(), key);
+        for (const auto& inputPath : op.getInputFilePaths(relativeToDirectory)) {
+            key = computeFileContentHash(inputPath, key);
+        }
+    }
+    return key;
+}
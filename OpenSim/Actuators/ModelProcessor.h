@@ -19,6 +19,7 @@
  * -------------------------------------------------------------------------- */
 
 #include "osimActuatorsDLL.h"
+#include <cstdint>
 
 #include <OpenSim/Simulation/Model/Model.h>
 
@@ -34,6 +35,13 @@ public:
     any files that this operator reads. */
     virtual void operate(
             Model& model, const std::string& relativeToDirectory) const = 0;
+    /** Paths of the files that operate() reads, resolved using
+    `relativeToDirectory`. ModelProcessor includes the contents of these files
+    in its memoization key. Operators that read files must override this. */
+    virtual std::vector<std::string> getInputFilePaths(
+            const std::string& /*relativeToDirectory*/) const {
+        return {};
+    }
 };
 
 /** This class describes a workflow for processing a Model using
@@ -42,7 +50,18 @@ property or the filepath property. In C++, one can easily chain together
 the operators in a processor using the C++ pipe operator:
 @code
 ModelProcessor proc = ModelProcessor("model.osim") | ModOpAddReserves();
-@endcode */
+@endcode
+
+@par Memoization
+If memoization is enabled with setMemoizationEnabled(), process() stores each
+processed model in memory under a key computed from the contents of the
+source model (the bytes of the .osim file, or the serialized Model object),
+the serialized operators, and the contents of any files the operators read
+(see ModelOperator::getInputFilePaths()), and returns a copy of the stored
+model when it is called again with the same key. Unlike TableProcessor,
+processed models are not written to disk, since they may refer to files
+(e.g., geometry or external loads data) relative to the source model's
+directory. */
 class OSIMACTUATORS_API ModelProcessor : public Object {
     OpenSim_DECLARE_CONCRETE_OBJECT(ModelProcessor, Object);
 
@@ -105,36 +124,15 @@ public:
     /** Process and obtain the model. If the base model is specified via the
     filepath property, the filepath will be evaluated relative to
     `relativeToDirectory`, if provided. */
-    Model process(const std::string& relativeToDirectory = {}) const {
-        Model model;
-        if (get_filepath().empty()) {
-            if (!getProperty_model().empty()) {
-                model = get_model();
-            } else {
-                OPENSIM_THROW_FRMOBJ(Exception, "No source model.");
-            }
-        } else {
-            OPENSIM_THROW_IF_FRMOBJ(!getProperty_model().empty(), Exception,
-                    "Expected either a Model object or a filepath, but "
-                    "both were provided.");
-            std::string path = get_filepath();
-            if (!relativeToDirectory.empty()) {
-                using SimTK::Pathname;
-                path = Pathname::
-                        getAbsolutePathnameUsingSpecifiedWorkingDirectory(
-                                relativeToDirectory, path);
-            }
-            Model modelFromFile(path);
-            model = std::move(modelFromFile);
-            model.finalizeFromProperties();
-            model.finalizeConnections();
-        }
-
-        for (int i = 0; i < getProperty_operators().size(); ++i) {
-            get_operators(i).operate(model, relativeToDirectory);
-        }
-        return model;
-    }
+    Model process(const std::string& relativeToDirectory = {}) const;
+
+    /** A hash of everything that determines the output of process(): the
+    contents of the source model, the serialized operators, and the contents
+    of any files the operators read. This is the key used for memoization,
+    and can be used by callers that cache objects derived from the processed
+    model. */
+    std::uint64_t computeContentKey(
+            const std::string& relativeToDirectory = {}) const;
 
     /** Append an operation to the end of the operations in this processor. */
     ModelProcessor& append(const ModelOperator& op) {
@@ -149,7 +147,27 @@ public:
         return append(right);
     }
 
+    /// @name Memoization
+    /// These settings apply to all ModelProcessors in this process.
+    /// @{
+    /** Enable or disable memoization of processed models (disabled by
+    default). */
+    static void setMemoizationEnabled(bool enabled);
+    static bool getMemoizationEnabled();
+    /** Remove all memoized processed models. */
+    static void clearMemoizedModels();
+    /// @}
+
 private:
+    /// The absolute path to the source model file, or an empty string if the
+    /// source is the model property.
+    std::string getSourcePath(const std::string& relativeToDirectory) const;
+    /// Load the source model and apply the operators, without memoization.
+    Model processWithoutMemoization(const std::string& sourcePath,
+            const std::string& relativeToDirectory) const;
+    std::uint64_t computeMemoizationKey(const std::string& sourcePath,
+            const std::string& relativeToDirectory) const;
+
     OpenSim_DECLARE_OPTIONAL_PROPERTY(model, Model, "Base model to process.");
 };
 
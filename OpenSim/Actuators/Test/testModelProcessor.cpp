@@ -80,6 +80,55 @@ TEST_CASE("ModelProcessor") {
     }
 }
 
+namespace {
+class CountingModelOperator : public ModelOperator {
+    OpenSim_DECLARE_CONCRETE_OBJECT(CountingModelOperator, ModelOperator);
+
+public:
+    void operate(Model& model, const std::string&) const override {
+        ++numCalls;
+        model.addAnalysis(new MuscleAnalysis());
+    }
+    static int numCalls;
+};
+int CountingModelOperator::numCalls = 0;
+} // anonymous namespace
+
+TEST_CASE("ModelProcessor memoization") {
+    Object::registerType(CountingModelOperator());
+    Model model = ModelFactory::createPendulum();
+    model.print("testModelProcessor_memo.osim");
+    ModelProcessor::clearMemoizedModels();
+    ModelProcessor::setMemoizationEnabled(true);
+    CountingModelOperator::numCalls = 0;
+
+    ModelProcessor proc = ModelProcessor("testModelProcessor_memo.osim") |
+                          CountingModelOperator();
+    Model first = proc.process();
+    Model second = proc.process();
+    CHECK(CountingModelOperator::numCalls == 1);
+    CHECK(second.getAnalysisSet().getSize() == 1);
+    CHECK(second.getNumCoordinates() == first.getNumCoordinates());
+    // The memoized model can be used like any other processed model.
+    second.initSystem();
+
+    // Adding an operator changes the key.
+    proc.append(ModOpRemoveMuscles());
+    proc.process();
+    CHECK(CountingModelOperator::numCalls == 2);
+
+    // Editing the source file changes the key.
+    model.setName("edited");
+    model.print("testModelProcessor_memo.osim");
+    CHECK(proc.process().getName() == "edited");
+    CHECK(CountingModelOperator::numCalls == 3);
+
+    ModelProcessor::setMemoizationEnabled(false);
+    ModelProcessor::clearMemoizedModels();
+    proc.process();
+    CHECK(CountingModelOperator::numCalls == 4);
+}
+
 TEST_CASE("ModOpRemoveMuscles") {
     Model model;
     using SimTK::Vec3;
@@ -0,0 +1,49 @@
+#ifndef OPENSIM_AUXILIARY_TEST_SIMULATION_FUNCTIONS_H_
+#define OPENSIM_AUXILIARY_TEST_SIMULATION_FUNCTIONS_H_
+/* -------------------------------------------------------------------------- *
+ *               OpenSim:  auxiliaryTestSimulationFunctions.h                 *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2022 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OpenSim/Simulation/Model/Model.h"
+#include "OpenSim/Simulation/SimbodyEngine/Coordinate.h"
+
+#include <algorithm>
+
+/** Set each coordinate of the model to a random value and each speed to a
+    random value in [-1, 1]. The values are drawn from the coordinate's range,
+    limited to [-pi, pi], and extended on each side by `rangeMargin` times its
+    width (use a positive margin to also test values outside of the range). */
+inline void randomizeCoordinates(const OpenSim::Model& model,
+        SimTK::State& state, SimTK::Random::Uniform& random,
+        double rangeMargin = 0) {
+    for (const auto& coord :
+            model.getComponentList<OpenSim::Coordinate>()) {
+        double min = std::max(coord.getRangeMin(), -SimTK::Pi);
+        double max = std::min(coord.getRangeMax(), SimTK::Pi);
+        const double margin = rangeMargin * (max - min);
+        min -= margin;
+        max += margin;
+        coord.setValue(state, min + (max - min) * random.getValue(), false);
+        coord.setSpeedValue(state, 2.0 * random.getValue() - 1.0);
+    }
+}
+
+#endif // OPENSIM_AUXILIARY_TEST_SIMULATION_FUNCTIONS_H_
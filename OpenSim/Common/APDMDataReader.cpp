@@ -1,5 +1,9 @@
 #include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
 #include "Simbody.h"
+#include "CommonUtilities.h"
 #include "Exception.h"
 #include "FileAdapter.h"
 #include "TimeSeriesTable.h"
@@ -131,61 +135,29 @@ APDMDataReader::extendRead(const std::string& fileName) const {
     // Line 4, Units unused
     std::getline(in_stream, line);
 
-    // For all tables, will create row, stitch values from different sensors then append
-    bool done = false;
+    // Read the rows in batches and parse the rows of each batch in parallel,
+    // converting only the columns that are used, directly into the
+    // matrices. The data ends at the first empty line. Once a batch is full,
+    // a ThreadPool is started so that the same threads parse all batches.
+    std::unique_ptr<ThreadPool> pool;
+    const int batchSize = 4096;
+    std::vector<std::string> lines(batchSize);
+    std::vector<FieldOffsets> fields(batchSize);
     double time = 0.0;
     double timeIncrement = 1 / dataRate;
     int rowNumber = 0;
-    while (!done){
-        // Make vectors one per table
-        TimeSeriesTableQuaternion::RowVector
-            orientation_row_vector{ n_imus, SimTK::Quaternion() };
-        TimeSeriesTableVec3::RowVector
-            accel_row_vector{ n_imus, SimTK::Vec3(SimTK::NaN) };
-        TimeSeriesTableVec3::RowVector
-            magneto_row_vector{ n_imus, SimTK::Vec3(SimTK::NaN) };
-        TimeSeriesTableVec3::RowVector
-            gyro_row_vector{ n_imus, SimTK::Vec3(SimTK::NaN) };
-        std::vector<std::string> nextRow = FileAdapter::getNextLine(in_stream, ",");
-        if (nextRow.empty()) {
-            done = true;
-            break;
-        }
-        // Cycle through the imus collating values
-        for (int imu_index = 0; imu_index < n_imus; ++imu_index) {
-            // parse gyro info from in_stream
-           if (foundLinearAccelerationData)
-                accel_row_vector[imu_index] = SimTK::Vec3(std::stod(nextRow[accIndex[imu_index]]),
-                    std::stod(nextRow[accIndex[imu_index] + 1]), std::stod(nextRow[accIndex[imu_index] + 2]));
-            if (foundMagneticHeadingData)
-                magneto_row_vector[imu_index] = SimTK::Vec3(std::stod(nextRow[magIndex[imu_index]]),
-                    std::stod(nextRow[magIndex[imu_index] + 1]), std::stod(nextRow[magIndex[imu_index] + 2]));
-            if (foundAngularVelocityData)
-                gyro_row_vector[imu_index] = SimTK::Vec3(std::stod(nextRow[gyroIndex[imu_index]]),
-                    std::stod(nextRow[gyroIndex[imu_index] + 1]), std::stod(nextRow[gyroIndex[imu_index] + 2]));
-            // Create Quaternion from values in file, assume order in file W, X, Y, Z
-            orientation_row_vector[imu_index] = 
-                SimTK::Quaternion(std::stod(nextRow[orientationsIndex[imu_index]]),
-                    std::stod(nextRow[orientationsIndex[imu_index] + 1]),
-                    std::stod(nextRow[orientationsIndex[imu_index] + 2]),
-                    std::stod(nextRow[orientationsIndex[imu_index] + 3]));
+    bool done = false;
+    while (!done) {
+        int numLines = 0;
+        while (numLines < batchSize && getNextLineFields(in_stream, ",",
+                    lines[numLines], fields[numLines])) {
+            ++numLines;
         }
-        // append to the tables
-        times[rowNumber] = time;
-        if (foundLinearAccelerationData) 
-            linearAccelerationData[rowNumber] =  accel_row_vector;
-        if (foundMagneticHeadingData) 
-            magneticHeadingData[rowNumber] = magneto_row_vector;
-        if (foundAngularVelocityData) 
-            angularVelocityData[rowNumber] = gyro_row_vector;
-        rotationsData[rowNumber] = orientation_row_vector;
-        // We could get some indication of time from file or generate time based on rate
-        // Here we use the latter mechanism.
-        time += timeIncrement;
-        rowNumber++;
-        if (std::remainder(rowNumber, last_size) == 0) {
+        done = numLines < batchSize;
+        if (rowNumber + numLines > last_size) {
             // resize all Data/Matrices, double the size  while keeping data
             int newSize = last_size*2;
+            while (rowNumber + numLines > newSize) newSize *= 2;
             times.resize(newSize);
             // Repeat for Data matrices in use
             if (foundLinearAccelerationData) linearAccelerationData.resizeKeep(newSize, n_imus);
@@ -194,6 +166,41 @@ APDMDataReader::extendRead(const std::string& fileName) const {
             rotationsData.resizeKeep(newSize, n_imus);
             last_size = newSize;
         }
+        const int firstRow = rowNumber;
+        const auto parseLine = [&](int iline) {
+            const std::string& nextRow = lines[iline];
+            const FieldOffsets& nextFields = fields[iline];
+            const int row = firstRow + iline;
+            // Cycle through the imus collating values
+            for (int imu_index = 0; imu_index < n_imus; ++imu_index) {
+                if (foundLinearAccelerationData)
+                    linearAccelerationData(row, imu_index) = parseVec3Fields(
+                            nextRow, nextFields, accIndex[imu_index]);
+                if (foundMagneticHeadingData)
+                    magneticHeadingData(row, imu_index) = parseVec3Fields(
+                            nextRow, nextFields, magIndex[imu_index]);
+                if (foundAngularVelocityData)
+                    angularVelocityData(row, imu_index) = parseVec3Fields(
+                            nextRow, nextFields, gyroIndex[imu_index]);
+                // Create Quaternion from values in file, assume order in file W, X, Y, Z
+                const int index = orientationsIndex[imu_index];
+                rotationsData(row, imu_index) = SimTK::Quaternion(
+                        parseField(nextRow, nextFields, index),
+                        parseField(nextRow, nextFields, index + 1),
+                        parseField(nextRow, nextFields, index + 2),
+                        parseField(nextRow, nextFields, index + 3));
+            }
+        };
+        if (!pool && numLines == batchSize) pool.reset(new ThreadPool());
+        if (pool) pool->parallelFor(numLines, parseLine);
+        else parallelFor(numLines, parseLine);
+        // We could get some indication of time from file or generate time based on rate
+        // Here we use the latter mechanism.
+        for (int iline = 0; iline < numLines; ++iline) {
+            times[rowNumber] = time;
+            time += timeIncrement;
+            rowNumber++;
+        }
     }
     // Trim Matrices in use to actual data and move into tables
     times.resize(rowNumber);
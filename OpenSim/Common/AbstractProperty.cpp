@@ -25,6 +25,7 @@
 //============================================================================
 #include "AbstractProperty.h"
 #include "Object.h"
+#include "XMLStreamWriter.h"
 
 #include <limits>
 
@@ -150,18 +151,8 @@ void AbstractProperty::readFromXMLParentElement(Xml::Element& parent,
     } else { // this property has a name
         // First pass: look for an object with that name attribute
         for (; iter != parent.element_end(); prev=iter++) 
-            if (iter->getOptionalAttributeValue("name") == getName()) {
-                // Found the right name; tag must be acceptable.
-                if (!isAcceptableObjectTag(iter->getElementTag())) {
-                    throw OpenSim::Exception
-                        ("Found XML element with expected property name=" + getName()
-                        + " in parent element " + parent.getElementTag()
-                        + " but its tag " + iter->getElementTag()
-                        + " was not an acceptable type for this property.");
-                    return;
-                }
-                break;
-            }
+            if (iter->getOptionalAttributeValue("name") == getName())
+                break; // Found the right name; tag must be acceptable.
         if (iter == parent.element_end()) {
             // Second pass: look for an unnamed object with the right type
             prev = parent.element_end();
@@ -180,6 +171,68 @@ void AbstractProperty::readFromXMLParentElement(Xml::Element& parent,
         return;
     }
 
+    readFromXMLObjectElement(parent, iter, prev, versionNumber);
+}
+
+AbstractProperty::ChildElementIndex::ChildElementIndex(Xml::Element& parent)
+{
+    Xml::element_iterator prev = parent.element_end();
+    Xml::element_iterator iter = parent.element_begin();
+    for (; iter != parent.element_end(); prev=iter++) {
+        // emplace() keeps the first element with a given tag or name.
+        _byTag.emplace(iter->getElementTag(), Entry(iter, prev));
+        const std::string name = iter->getOptionalAttributeValue("name");
+        if (!name.empty())
+            _byName.emplace(name, Entry(iter, prev));
+    }
+}
+
+// This follows the same policy as the signature above.
+void AbstractProperty::readFromXMLParentElement(Xml::Element& parent,
+                                                const ChildElementIndex& index,
+                                                int versionNumber)
+{
+    if (!isUnnamedProperty()) {
+        const auto found = index._byTag.find(getName());
+        if (found != index._byTag.end()) {
+            Xml::element_iterator propElt = found->second.first;
+            readFromXMLElement(*propElt, versionNumber);
+            setValueIsDefault(false);
+            return;
+        }
+    }
+
+    if (!isOneObjectProperty()) {
+        setValueIsDefault(true); // no special format allowed
+        return;
+    }
+
+    if (!isUnnamedProperty()) {
+        const auto found = index._byName.find(getName());
+        if (found != index._byName.end()) {
+            readFromXMLObjectElement(parent, found->second.first,
+                                     found->second.second, versionNumber);
+            return;
+        }
+    }
+
+    // The object is identified by its type alone (it is unnamed, or is an
+    // unnamed object in an old file), so search as usual.
+    readFromXMLParentElement(parent, versionNumber);
+}
+
+void AbstractProperty::readFromXMLObjectElement(
+        Xml::Element& parent, Xml::element_iterator iter,
+        Xml::element_iterator prev, int versionNumber)
+{
+    if (!isAcceptableObjectTag(iter->getElementTag())) {
+        throw OpenSim::Exception
+            ("Found XML element with expected property name=" + getName()
+            + " in parent element " + parent.getElementTag()
+            + " but its tag " + iter->getElementTag()
+            + " was not an acceptable type for this property.");
+    }
+
     // Found a match. Borrow the object node briefly and canonicalize it 
     // into a conventional <propName> object </propName> structure.
     std::string propName = isUnnamedProperty() ? "Unnamed" : getName();
@@ -226,3 +279,29 @@ void AbstractProperty::writeToXMLParentElement(Xml::Element& parent) const {
     obj.updateXMLNode(parent, this);
 }
 
+void AbstractProperty::writeToXMLStream(XMLStreamWriter& writer) const {
+    // This must write the same nodes as writeToXMLParentElement().
+    if (!getComment().empty())
+        writer.writeComment(getComment());
+
+    if (isOneObjectProperty()) {
+        getValueAsObject().writeToXMLStream(writer, this);
+        return;
+    }
+
+    assert(!getName().empty());
+    if (isObjectProperty()) {
+        // Stream each object rather than building its element.
+        writer.startElement(getName());
+        for (int i = 0; i < getNumValues(); ++i)
+            getValueAsObject(i).writeToXMLStream(writer);
+        writer.endElement();
+        return;
+    }
+
+    // The element for a simple property is small, so build it as usual.
+    Xml::Element propElement(getName());
+    writeToXMLElement(propElement);
+    writer.writeElement(propElement);
+}
+
@@ -27,6 +27,8 @@
 #include <assert.h>
 #include <string>
 #include <typeinfo>
+#include <unordered_map>
+#include <utility>
 #include "osimCommonDLL.h"
 #include "Exception.h"
 #include "SimTKcommon/internal/Xml.h"
@@ -35,6 +37,7 @@
 namespace OpenSim {
 
 class Object;
+class XMLStreamWriter;
 template <class T> class Property;
 
 //==============================================================================
@@ -251,10 +254,42 @@ public:
     void readFromXMLParentElement(SimTK::Xml::Element& parent,
                                   int                  versionNumber);
 
+    /** The child elements of an XML element, indexed by tag and by the value
+    of their "name" attribute (only the first element with a given tag or
+    name is indexed). Building the index takes a single pass over the
+    children, after which each property of an Object can locate its element
+    without searching the children again. **/
+    class OSIMCOMMON_API ChildElementIndex {
+    public:
+        explicit ChildElementIndex(SimTK::Xml::Element& parent);
+    private:
+        friend class AbstractProperty;
+        // An element and the element that precedes it (or element_end()).
+        using Entry = std::pair<SimTK::Xml::element_iterator,
+                                SimTK::Xml::element_iterator>;
+        std::unordered_map<std::string, Entry> _byTag;
+        std::unordered_map<std::string, Entry> _byName;
+    };
+
+    /** Same as readFromXMLParentElement(parent, versionNumber), except that
+    the property element (or the element of a one-object property's object) is
+    looked up in the given index of the parent's children instead of by
+    searching them. Object::updateFromXMLNode() uses this for documents at the
+    latest version. **/
+    void readFromXMLParentElement(SimTK::Xml::Element&     parent,
+                                  const ChildElementIndex& index,
+                                  int                      versionNumber);
+
     /** Given an XML parent element, append a single child element representing
     the serialized form of this property. **/
     void writeToXMLParentElement(SimTK::Xml::Element& parent) const;
 
+    /** Write the serialized form of this property (the same nodes that
+    writeToXMLParentElement() appends) to the given writer, as children of
+    the writer's current element. Contained objects are streamed without
+    building their XML elements in memory. **/
+    void writeToXMLStream(XMLStreamWriter& writer) const;
+
 
     /** %Set the property name. **/
     void setName(const std::string& name){ _name = name; }
@@ -397,6 +432,14 @@ protected:
 
 private:
     void setNull();
+    // Read the value of a one-object property from objectElement, a child of
+    // parent of the form <ObjectTypeTag ...> contents </ObjectTypeTag>.
+    // previous is the child element preceding objectElement (or
+    // parent.element_end()).
+    void readFromXMLObjectElement(SimTK::Xml::Element&         parent,
+                                  SimTK::Xml::element_iterator objectElement,
+                                  SimTK::Xml::element_iterator previous,
+                                  int                          versionNumber);
 
     std::string _name;
     std::string _comment;
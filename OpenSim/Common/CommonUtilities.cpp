@@ -26,11 +26,17 @@
 #include "PiecewiseLinearFunction.h"
 #include "STOFileAdapter.h"
 #include "TimeSeriesTable.h"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <ctime>
+#include <exception>
+#include <fstream>
 #include <iomanip>
 #include <memory>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include <SimTKcommon/internal/Pathname.h>
 
@@ -135,6 +141,34 @@ std::string OpenSim::convertRelativeFilePathToAbsoluteFromXMLDocument(
             directory, filePathRelativeToDocument);
 }
 
+std::uint64_t OpenSim::computeContentHash(
+        const void* data, std::size_t size, std::uint64_t hash) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::uint64_t OpenSim::computeContentHash(
+        const std::string& content, std::uint64_t hash) {
+    return computeContentHash(content.data(), content.size(), hash);
+}
+
+std::uint64_t OpenSim::computeFileContentHash(
+        const std::string& filepath, std::uint64_t hash) {
+    std::ifstream file(filepath, std::ios::binary);
+    OPENSIM_THROW_IF(!file, Exception,
+            "Could not open file '{}' to compute its hash.", filepath);
+    char buffer[65536];
+    while (file) {
+        file.read(buffer, sizeof(buffer));
+        hash = computeContentHash(buffer, (std::size_t)file.gcount(), hash);
+    }
+    return hash;
+}
+
 SimTK::Real OpenSim::solveBisection(
         std::function<SimTK::Real(const SimTK::Real&)> calcResidual,
         SimTK::Real left, SimTK::Real right, const SimTK::Real& tolerance,
@@ -183,3 +217,129 @@ SimTK::Real OpenSim::solveBisection(
     }
     return midpoint;
 }
+
+namespace {
+int resolveNumThreads(int numThreads) {
+    if (numThreads < 1)
+        numThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    return numThreads;
+}
+// Run the remaining tasks of a loop, keeping the first exception.
+void runTasks(int count, const std::function<void(int)>& task,
+        std::atomic<int>& next, std::exception_ptr& error,
+        std::mutex& errorMutex) {
+    for (int i = next++; i < count; i = next++) {
+        try {
+            task(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) error = std::current_exception();
+        }
+    }
+}
+} // anonymous namespace
+
+void OpenSim::parallelFor(int count, const std::function<void(int)>& task,
+        int numThreads) {
+    numThreads = std::min(resolveNumThreads(numThreads), count);
+    std::atomic<int> next(0);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto work = [&]() { runTasks(count, task, next, error, errorMutex); };
+    std::vector<std::thread> threads;
+    for (int ithread = 1; ithread < numThreads; ++ithread) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& thread : threads) thread.join();
+    if (error) std::rethrow_exception(error);
+}
+
+struct OpenSim::ThreadPool::Impl {
+    std::vector<std::thread> workers;
+    // Only one loop runs at a time.
+    std::mutex loopMutex;
+    // Guards the members below, which describe the current loop.
+    std::mutex mutex;
+    std::condition_variable loopStarted;
+    std::condition_variable loopFinished;
+    unsigned long long loopIndex = 0;
+    int numWorkersInLoop = 0;
+    bool stop = false;
+    int count = 0;
+    const std::function<void(int)>* task = nullptr;
+    std::atomic<int> next{0};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    void work() {
+        unsigned long long lastLoopIndex = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            loopStarted.wait(lock,
+                    [&] { return stop || loopIndex != lastLoopIndex; });
+            if (stop) return;
+            lastLoopIndex = loopIndex;
+            lock.unlock();
+            runTasks(count, *task, next, error, errorMutex);
+            lock.lock();
+            // Every worker takes part in every loop, so no worker can miss
+            // the start of a loop.
+            if (--numWorkersInLoop == 0) loopFinished.notify_one();
+        }
+    }
+};
+
+OpenSim::ThreadPool::ThreadPool(int numThreads) : m_impl(new Impl()) {
+    numThreads = resolveNumThreads(numThreads);
+    for (int ithread = 1; ithread < numThreads; ++ithread) {
+        m_impl->workers.emplace_back([this] { m_impl->work(); });
+    }
+}
+
+OpenSim::ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_impl->mutex);
+        m_impl->stop = true;
+    }
+    m_impl->loopStarted.notify_all();
+    for (auto& worker : m_impl->workers) worker.join();
+}
+
+int OpenSim::ThreadPool::getNumThreads() const {
+    return (int)m_impl->workers.size() + 1;
+}
+
+void OpenSim::ThreadPool::parallelFor(int count,
+        const std::function<void(int)>& task) {
+    auto& impl = *m_impl;
+    std::lock_guard<std::mutex> loopLock(impl.loopMutex);
+    if (impl.workers.empty() || count <= 1) {
+        std::atomic<int> next(0);
+        std::exception_ptr error;
+        std::mutex errorMutex;
+        runTasks(count, task, next, error, errorMutex);
+        if (error) std::rethrow_exception(error);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(impl.mutex);
+        impl.count = count;
+        impl.task = &task;
+        impl.next = 0;
+        impl.error = nullptr;
+        impl.numWorkersInLoop = (int)impl.workers.size();
+        ++impl.loopIndex;
+    }
+    impl.loopStarted.notify_all();
+    runTasks(count, task, impl.next, impl.error, impl.errorMutex);
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(impl.mutex);
+        impl.loopFinished.wait(
+                lock, [&] { return impl.numWorkersInLoop == 0; });
+        impl.task = nullptr;
+        error = impl.error;
+    }
+    if (error) std::rethrow_exception(error);
+}
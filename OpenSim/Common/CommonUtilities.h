@@ -24,6 +24,7 @@
  * -------------------------------------------------------------------------- */
 
 #include "osimCommonDLL.h"
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -107,6 +108,27 @@ std::string convertRelativeFilePathToAbsoluteFromXMLDocument(
         const std::string& documentFileName,
         const std::string& filePathRelativeToDirectoryContainingDocument);
 
+/// Compute a 64-bit FNV-1a hash of `size` bytes starting at `data`. Pass the
+/// result of a previous call as `hash` to hash several buffers in sequence.
+/// This is a content hash for use as a cache key; it is not cryptographic.
+/// @ingroup commonutil
+OSIMCOMMON_API
+std::uint64_t computeContentHash(const void* data, std::size_t size,
+        std::uint64_t hash = 14695981039346656037ULL);
+
+/// Same as above, for the characters of a string.
+/// @ingroup commonutil
+OSIMCOMMON_API
+std::uint64_t computeContentHash(const std::string& content,
+        std::uint64_t hash = 14695981039346656037ULL);
+
+/// Same as above, for the contents of the file at `filepath`.
+/// @throws Exception if the file cannot be opened.
+/// @ingroup commonutil
+OSIMCOMMON_API
+std::uint64_t computeFileContentHash(const std::string& filepath,
+        std::uint64_t hash = 14695981039346656037ULL);
+
 /// Solve for the root of a scalar function using the bisection method.
 /// If the values of calcResidual(left) and calcResidual(right) have the same
 /// sign and the logger level is Debug (or more verbose), then this function
@@ -124,6 +146,41 @@ SimTK::Real solveBisection(std::function<double(const double&)> calcResidual,
         double left, double right, const double& tolerance = 1e-6,
         int maxIterations = 1000);
 
+/// Call `task(i)` for i = 0, ..., count - 1, spreading the calls over up to
+/// `numThreads` threads, including the calling thread. If `numThreads` is
+/// less than 1, the number of hardware threads is used. The tasks must be
+/// independent. If any tasks throw, one of the exceptions is rethrown once
+/// all tasks have finished. This starts new threads on every call; to run
+/// many loops, use a ThreadPool instead.
+/// @ingroup commonutil
+OSIMCOMMON_API
+void parallelFor(int count, const std::function<void(int)>& task,
+        int numThreads = 0);
+
+/// A set of threads that runs loops of independent tasks, as parallelFor()
+/// does, without starting new threads for every loop. The calling thread
+/// also runs tasks, so the pool starts one thread fewer than getNumThreads().
+/// Loops run one at a time; a task must not start a loop on the same pool.
+/// @ingroup commonutil
+class OSIMCOMMON_API ThreadPool {
+public:
+    /// If `numThreads` is less than 1, the number of hardware threads is used.
+    explicit ThreadPool(int numThreads = 0);
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ~ThreadPool();
+    /// The number of threads that run tasks, including the calling thread.
+    int getNumThreads() const;
+    /// Call `task(i)` for i = 0, ..., count - 1 on the threads of the pool,
+    /// and wait for all calls to finish. If any tasks throw, one of the
+    /// exceptions is rethrown once all tasks have finished.
+    void parallelFor(int count, const std::function<void(int)>& task);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+};
+
 /// This class lets you store objects of a single type for reuse by multiple
 /// threads, ensuring threadsafe access to each of those objects.
 /// @ingroup commonutil
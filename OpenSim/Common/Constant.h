@@ -89,6 +89,12 @@ public:
     {
         return _value;
     }
+    SimTK::Vec3 calcValueAndDerivatives(double xUnused,
+            int maxDerivOrder = 2) const override
+    {
+        return SimTK::Vec3(_value, 0, 0);
+    }
+    bool hasFastValueAndDerivatives() const override { return true; }
     double getValue() const { return _value; }
     SimTK::Function* createSimTKFunction() const override;
 //=============================================================================
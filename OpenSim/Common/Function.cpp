@@ -173,6 +173,17 @@ double Function::calcDerivative(const std::vector<int>& derivComponents, const V
     return _function->calcDerivative(derivComponents, x);
 }
 
+SimTK::Vec3 Function::calcValueAndDerivatives(double x,
+        int maxDerivOrder) const
+{
+    SimTK::Vec3 result(SimTK::NaN);
+    const SimTK::Vector arg(1, x);
+    result[0] = calcValue(arg);
+    if (maxDerivOrder >= 1) result[1] = calcDerivative({0}, arg);
+    if (maxDerivOrder >= 2) result[2] = calcDerivative({0, 0}, arg);
+    return result;
+}
+
 int Function::getArgumentSize() const
 {
     if (_function == NULL)
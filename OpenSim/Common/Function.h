@@ -114,6 +114,36 @@ public:
      * @param x                the Vector of input arguments.  Its size must equal the value returned by getArgumentSize().
      */
     virtual double calcDerivative(const std::vector<int>& derivComponents, const SimTK::Vector& x) const;
+    /**
+     * Calculate the value and the first and second derivatives of a function
+     * of a single argument (getArgumentSize() == 1). This avoids the
+     * SimTK::Vector and std::vector arguments of calcValue() and
+     * calcDerivative(), and lets a function share work between the value and
+     * its derivatives (e.g., locating the interval of a spline), so use it
+     * in code that evaluates a function frequently (e.g., whenever the
+     * kinematics are realized).
+     *
+     * @param x              the argument.
+     * @param maxDerivOrder  the highest derivative needed (0, 1, or 2).
+     *                       Derivatives above this order may not be
+     *                       calculated, and their values are unspecified.
+     * @return the value, the first derivative, and the second derivative.
+     *
+     * The default implementation calls calcValue() and calcDerivative();
+     * the common functions of a single argument override it with an
+     * implementation that does not allocate.
+     */
+    virtual SimTK::Vec3 calcValueAndDerivatives(double x,
+            int maxDerivOrder = 2) const;
+    /**
+     * Whether this function overrides calcValueAndDerivatives() with an
+     * implementation that does not allocate. Callers that could use either
+     * calcValueAndDerivatives() or calcDerivative() (e.g., to evaluate a
+     * single derivative) should use calcValueAndDerivatives() only if this
+     * returns true, since the default implementation of
+     * calcValueAndDerivatives() also computes the lower derivatives.
+     */
+    virtual bool hasFastValueAndDerivatives() const { return false; }
     /**
      * Get the number of components expected in the input vector.
      */
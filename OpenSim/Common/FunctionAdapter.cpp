@@ -52,8 +52,29 @@ double FunctionAdapter::calcDerivative(const std::vector<int>& derivComponents,
 }
 
 double FunctionAdapter::calcDerivative(const SimTK::Array_<int>& derivComponents, const SimTK::Vector& x) const{
-    std::vector<int> dcs(derivComponents.begin(), derivComponents.end());
-    return _function.calcDerivative(dcs, x);
+    // Functions of a single argument that implement calcValueAndDerivatives()
+    // provide their first and second derivatives without needing
+    // derivComponents as a std::vector.
+    const int order = (int)derivComponents.size();
+    if (x.size() == 1 && (order == 1 || order == 2) &&
+            _function.hasFastValueAndDerivatives())
+        return _function.calcValueAndDerivatives(x[0], order)[order];
+
+    // Otherwise, reuse a buffer rather than allocating on every call. The
+    // buffer is not reused if the wrapped function itself (indirectly) calls
+    // this method.
+    thread_local std::vector<int> buffer;
+    thread_local bool bufferInUse = false;
+    if (bufferInUse) {
+        std::vector<int> dcs(derivComponents.begin(), derivComponents.end());
+        return _function.calcDerivative(dcs, x);
+    }
+    struct BufferGuard {
+        ~BufferGuard() { bufferInUse = false; }
+    } guard;
+    bufferInUse = true;
+    buffer.assign(derivComponents.begin(), derivComponents.end());
+    return _function.calcDerivative(buffer, x);
 }
 
 int FunctionAdapter::getArgumentSize() const {
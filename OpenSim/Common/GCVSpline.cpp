@@ -580,6 +580,18 @@ addPoint(double aX, double aY)
     return i;
 }
 
+SimTK::Vec3 GCVSpline::calcValueAndDerivatives(double x,
+        int maxDerivOrder) const {
+    if (_function == NULL)
+        _function = createSimTKFunction();
+    // Evaluate the spline directly with a scalar argument.
+    const auto& spline = static_cast<const SimTK::Spline&>(*_function);
+    SimTK::Vec3 result(spline.calcValue(x), SimTK::NaN, SimTK::NaN);
+    if (maxDerivOrder >= 1) result[1] = spline.calcDerivative(1, x);
+    if (maxDerivOrder >= 2) result[2] = spline.calcDerivative(2, x);
+    return result;
+}
+
 SimTK::Function* GCVSpline::createSimTKFunction() const {
     int degree = _halfOrder*2-1;
     Vector x(_x.getSize());
@@ -233,6 +233,9 @@ public:
     //--------------------------------------------------------------------------
     // EVALUATION
     //--------------------------------------------------------------------------
+    SimTK::Vec3 calcValueAndDerivatives(double x,
+            int maxDerivOrder = 2) const override;
+    bool hasFastValueAndDerivatives() const override { return true; }
 
 //=============================================================================
 };  // END class GCVSpline
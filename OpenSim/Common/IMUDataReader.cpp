@@ -1,5 +1,10 @@
 #include "IMUDataReader.h"
 
+#include "Exception.h"
+
+#include <cctype>
+#include <cstdlib>
+
 namespace OpenSim {
 
     const std::string IMUDataReader::Orientations{ "orientations" };         // name of table for orientation data
@@ -48,4 +53,48 @@ namespace OpenSim {
         return tables;
 
     }
+
+    bool IMUDataReader::getNextLineFields(std::istream& stream,
+            const std::string& delimiters, std::string& line,
+            FieldOffsets& fields) {
+        fields.clear();
+        if (!std::getline(stream, line)) return false;
+        // Get rid of the extra \r if parsing a file with CRLF line endings.
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        // Same splitting as FileAdapter::tokenize(): a field ends at each
+        // delimiter, and the text after the last delimiter is a field only if
+        // it is not empty.
+        std::size_t start = 0;
+        std::size_t end;
+        while ((end = line.find_first_of(delimiters, start)) !=
+                std::string::npos) {
+            fields.emplace_back(start, end);
+            start = end + 1;
+        }
+        if (line.size() > start) fields.emplace_back(start, line.size());
+        return !fields.empty();
+    }
+
+    double IMUDataReader::parseField(const std::string& line,
+            const FieldOffsets& fields, int index) {
+        OPENSIM_THROW_IF(index < 0 || index >= (int)fields.size(), Exception,
+                "Expected at least " + std::to_string(index + 1) +
+                " fields but got " + std::to_string(fields.size()) +
+                " in line '" + line + "'.");
+        const char* begin = line.c_str() + fields[index].first;
+        const char* end = line.c_str() + fields[index].second;
+        // std::strtod() skips leading whitespace, which must not take it past
+        // the end of the field (e.g., into the next field after a tab).
+        while (begin != end && std::isspace((unsigned char)*begin)) ++begin;
+        char* parsedEnd = nullptr;
+        const double value =
+                begin == end ? 0 : std::strtod(begin, &parsedEnd);
+        OPENSIM_THROW_IF(begin == end || parsedEnd == begin, Exception,
+                "Expected a number in field " + std::to_string(index) +
+                " but got '" +
+                line.substr(fields[index].first,
+                        fields[index].second - fields[index].first) +
+                "' in line '" + line + "'.");
+        return value;
+    }
 }
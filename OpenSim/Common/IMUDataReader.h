@@ -25,6 +25,9 @@
 #include "TimeSeriesTable.h"
 #include "DataAdapter.h"
 
+#include <istream>
+#include <utility>
+
 /** @file
 * This file defines common base class for various IMU DataReader
 * classes that support different IMU providers
@@ -78,6 +81,30 @@ protected:
         const SimTK::Matrix_<SimTK::Vec3>& linearAccelerationData, 
         const SimTK::Matrix_<SimTK::Vec3>& magneticHeadingData, 
         const SimTK::Matrix_<SimTK::Vec3>& angularVelocityData) const;
+
+    /** The beginning and end (as offsets into the line) of each field of a
+    line of delimited text. */
+    using FieldOffsets = std::vector<std::pair<std::size_t, std::size_t>>;
+    /** Read the next line of the stream and find its fields, splitting the
+    line as FileAdapter::getNextLine() does, but without creating a string for
+    each field. Returns false if there are no more lines or the line is
+    empty. Numeric fields can then be converted with parseField(). */
+    static bool getNextLineFields(std::istream& stream,
+            const std::string& delimiters, std::string& line,
+            FieldOffsets& fields);
+    /** Convert field `index` of a line read with getNextLineFields() to a
+    double, as std::stod() would convert the corresponding token. This throws
+    an exception if the line does not have that field or the field is not a
+    number. */
+    static double parseField(const std::string& line,
+            const FieldOffsets& fields, int index);
+    /** Convert the three fields starting at field `index` to a Vec3. */
+    static SimTK::Vec3 parseVec3Fields(const std::string& line,
+            const FieldOffsets& fields, int index) {
+        return SimTK::Vec3(parseField(line, fields, index),
+                parseField(line, fields, index + 1),
+                parseField(line, fields, index + 2));
+    }
 };
 
 } // OpenSim namespace
@@ -101,6 +101,12 @@ public:
     //--------------------------------------------------------------------------
     // EVALUATION
     //--------------------------------------------------------------------------
+    SimTK::Vec3 calcValueAndDerivatives(double x,
+            int maxDerivOrder = 2) const override
+    {
+        return SimTK::Vec3(getSlope()*x + getIntercept(), getSlope(), 0);
+    }
+    bool hasFastValueAndDerivatives() const override { return true; }
     SimTK::Function* createSimTKFunction() const override;
 
 //=============================================================================
@@ -24,7 +24,8 @@
 
 // C++ INCLUDES
 #include "MultiplierFunction.h"
-#include "FunctionAdapter.h"
+
+#include <memory>
 
 using namespace OpenSim;
 using namespace std;
@@ -182,6 +183,22 @@ double MultiplierFunction::calcValue(const SimTK::Vector& x) const
     }
 }
 
+SimTK::Vec3 MultiplierFunction::calcValueAndDerivatives(double x,
+        int maxDerivOrder) const
+{
+    if (_osFunction)
+        return _osFunction->calcValueAndDerivatives(x, maxDerivOrder) * _scale;
+    else {
+        throw Exception("MultiplierFunction::calcValueAndDerivatives(): _osFunction is NULL.");
+        return SimTK::Vec3(0.0);
+    }
+}
+
+bool MultiplierFunction::hasFastValueAndDerivatives() const
+{
+    return _osFunction && _osFunction->hasFastValueAndDerivatives();
+}
+
 int MultiplierFunction::getArgumentSize() const
 {
     if (_osFunction)
@@ -202,8 +219,45 @@ int MultiplierFunction::getMaxDerivativeOrder() const
     }
 }
 
+namespace {
+/* Scales the SimTK::Function created by the wrapped OpenSim::Function, so that
+ * specialized implementations (e.g., that of SimmSpline) are used for the
+ * scaled function as well. The wrapped function is immutable, so clones can
+ * share it. */
+class SimTKMultiplierFunction : public SimTK::Function {
+public:
+    SimTKMultiplierFunction(SimTK::Function* function, double scale)
+            : m_function(function), m_scale(scale) {}
+    double calcValue(const SimTK::Vector& x) const override {
+        return m_function->calcValue(x) * m_scale;
+    }
+    double calcDerivative(const SimTK::Array_<int>& derivComponents,
+            const SimTK::Vector& x) const override {
+        return m_function->calcDerivative(derivComponents, x) * m_scale;
+    }
+    int getArgumentSize() const override {
+        return m_function->getArgumentSize();
+    }
+    int getMaxDerivativeOrder() const override {
+        return m_function->getMaxDerivativeOrder();
+    }
+    SimTKMultiplierFunction* clone() const override {
+        return new SimTKMultiplierFunction(*this);
+    }
+
+private:
+    std::shared_ptr<const SimTK::Function> m_function;
+    double m_scale;
+};
+} // anonymous namespace
+
 SimTK::Function* MultiplierFunction::createSimTKFunction() const {
-    return new FunctionAdapter(*this);
+    if (!_osFunction) {
+        throw Exception("MultiplierFunction::createSimTKFunction(): "
+                        "_osFunction is NULL.");
+    }
+    return new SimTKMultiplierFunction(
+            _osFunction->createSimTKFunction(), _scale);
 }
 
 void MultiplierFunction::init(Function* aFunction)
@@ -32,13 +32,39 @@
 
 #include "Object.h"
 
+#include "CommonUtilities.h"
 #include "Exception.h"
 #include "IO.h"
 #include "Logger.h"
 #include "PropertyTransform.h"
 #include "Property_Deprecated.h"
 #include "XMLDocument.h"
+#include "XMLStreamWriter.h"
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <ctime>
 #include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <io.h>
+    #include <windows.h>
+#else
+    #include <climits>
+    #include <cstdlib>
+    #include <unistd.h>
+#endif
 
 using namespace OpenSim;
 using namespace std;
@@ -53,8 +79,40 @@ std::map<string,Object*>    Object::_mapTypesToDefaultObjects;
 std::map<string,string>     Object::_renamedTypesMap;
 
 bool                        Object::_serializeAllDefaults=false;
+int                         Object::_numThreadsForReadingXML=1;
 const string                Object::DEFAULT_NAME(ObjectDEFAULT_NAME);
 
+namespace {
+// While an instance exists, the object lists read on this thread share one
+// ThreadPool instead of starting threads for each list. Reading a document
+// creates an instance; only the outermost instance on a thread is used.
+class ReadingThreadPoolScope {
+public:
+    ReadingThreadPoolScope() : _outermost(current == nullptr) {
+        if (_outermost) current = this;
+    }
+    ReadingThreadPoolScope(const ReadingThreadPoolScope&) = delete;
+    ReadingThreadPoolScope& operator=(const ReadingThreadPoolScope&) = delete;
+    ~ReadingThreadPoolScope() {
+        if (_outermost) current = nullptr;
+    }
+    // The pool of the current scope, created the first time it is needed;
+    // nullptr if there is no scope.
+    static ThreadPool* getPool(int numThreads) {
+        if (!current) return nullptr;
+        auto& pool = current->_pool;
+        if (!pool || pool->getNumThreads() != numThreads)
+            pool.reset(new ThreadPool(numThreads));
+        return pool.get();
+    }
+private:
+    static thread_local ReadingThreadPoolScope* current;
+    bool _outermost;
+    std::unique_ptr<ThreadPool> _pool;
+};
+thread_local ReadingThreadPoolScope* ReadingThreadPoolScope::current = nullptr;
+} // anonymous namespace
+
 //=============================================================================
 // CONSTRUCTOR(S)
 //=============================================================================
@@ -116,6 +174,7 @@ Object::Object(const string &aFileName, bool aUpdateFromXMLNode)
     // of an exception.
     if (aUpdateFromXMLNode) {
         IO::CwdChanger cwd = IO::CwdChanger::changeToParentOf(aFileName);
+        ReadingThreadPoolScope threadPoolScope;
         updateFromXMLNode(myNode, _document->getDocumentVersion());
     }
 }
@@ -719,6 +778,76 @@ void Object::readObjectFromXMLNodeOrFile
     updateFromXMLNode(e, newDoc->getDocumentVersion());
 }
 
+void Object::setNumThreadsForReadingXML(int numThreads)
+{
+    OPENSIM_THROW_IF(numThreads < 0, Exception,
+        "Expected the number of threads to be non-negative, but got " +
+        std::to_string(numThreads) + ".");
+    _numThreadsForReadingXML = numThreads;
+}
+
+// Lists with fewer objects than this are not worth starting threads for.
+static const int MinObjectsToReadInParallel = 8;
+// Whether the element or any element nested in it refers to another file.
+static bool hasFileAttributeInTree(SimTK::Xml::Element& element)
+{
+    if (element.hasAttribute("file")) return true;
+    for (auto it = element.element_begin(); it != element.element_end(); ++it)
+        if (hasFileAttributeInTree(*it)) return true;
+    return false;
+}
+// Objects read on worker threads read their own object lists sequentially,
+// so that the number of threads does not multiply.
+static thread_local bool isReadingObjectsInParallel = false;
+
+void Object::readObjectsFromXMLElements(const std::vector<Object*>& objects,
+                                        std::vector<SimTK::Xml::Element>& objectElements,
+                                        int versionNumber)
+{
+    assert(objects.size() == objectElements.size());
+    const int numObjects = (int)objects.size();
+
+    int numThreads = _numThreadsForReadingXML;
+    if (numThreads == 0)
+        numThreads = std::max(1, (int)std::thread::hardware_concurrency());
+
+    // Objects in a document at an older version may be upgraded by editing
+    // the elements around them, and objects (or their nested objects) read
+    // from other files change the current working directory, so those are
+    // read in order on this thread.
+    bool readInParallel = numThreads > 1 &&
+        numObjects >= MinObjectsToReadInParallel &&
+        versionNumber == XMLDocument::getLatestVersion() &&
+        !isReadingObjectsInParallel;
+    for (int i=0; readInParallel && i < numObjects; ++i) {
+        if (hasFileAttributeInTree(objectElements[i]))
+            readInParallel = false;
+    }
+
+    if (!readInParallel) {
+        for (int i=0; i < numObjects; ++i)
+            objects[i]->readObjectFromXMLNodeOrFile(objectElements[i],
+                                                    versionNumber);
+        return;
+    }
+
+    // Each object only edits its own element, so the objects can be read
+    // independently.
+    auto readObject = [&](int i) {
+        struct FlagGuard {
+            bool previous = isReadingObjectsInParallel;
+            FlagGuard() { isReadingObjectsInParallel = true; }
+            ~FlagGuard() { isReadingObjectsInParallel = previous; }
+        } guard;
+        objects[i]->readObjectFromXMLNodeOrFile(objectElements[i],
+                                                versionNumber);
+    };
+    if (ThreadPool* pool = ReadingThreadPoolScope::getPool(numThreads))
+        pool->parallelFor(numObjects, readObject);
+    else
+        parallelFor(numObjects, readObject, numThreads);
+}
+
 template<class T> static void 
 UpdateXMLNodeSimpleProperty(const Property_Deprecated*  aProperty, 
                             SimTK::Xml::Element&        dParentNode, 
@@ -775,6 +904,91 @@ UpdateXMLNodeTransform(const Property_Deprecated*   aProperty,
 }
 
 
+//_____________________________________________________________________________
+/**
+ * Append the element for a deprecated property whose value is not an Object.
+ */
+static void
+UpdateXMLNodeSimpleDeprecatedProperty(const Property_Deprecated*  prop,
+                                      SimTK::Xml::Element&        aNode)
+{
+    const Property_Deprecated::PropertyType type = prop->getType();
+    const string name = prop->getName();
+    string stringValue="";
+    switch(type) {
+
+    // Bool
+    case(Property_Deprecated::Bool) :
+        UpdateXMLNodeSimpleProperty<bool>(prop, aNode, name);
+        break;
+    // Int
+    case(Property_Deprecated::Int) :
+        UpdateXMLNodeSimpleProperty<int>(prop, aNode, name);
+        break;
+    // Dbl
+    case(Property_Deprecated::Dbl) :
+        if (SimTK::isFinite(prop->getValueDbl()))
+            UpdateXMLNodeSimpleProperty<double>(prop, aNode, name);
+        else {
+            if (prop->getValueDbl() == SimTK::Infinity)
+                stringValue="Inf";
+            else if (prop->getValueDbl() == -SimTK::Infinity)
+                stringValue="-Inf";
+            else if (SimTK::isNaN(prop->getValueDbl()))
+                stringValue="NaN";
+            if(!prop->getValueIsDefault()) {
+                SimTK::Xml::Element elt(prop->getName(), stringValue);
+                aNode.insertNodeAfter(aNode.node_end(), elt);
+            }
+        } 
+        break;
+    // Str
+    case(Property_Deprecated::Str) :
+        UpdateXMLNodeSimpleProperty<string>(prop, aNode, name);
+        break;
+    // BoolArray
+    case(Property_Deprecated::BoolArray) :
+        // print array as String and add it as such to element
+        //UpdateXMLNodeArrayProperty<bool>(prop,aNode,name); BoolArray Handling on Write
+        stringValue = "";
+        {
+            //int n = prop->getArraySize();
+            const Array<bool> &valueBs = prop->getValueArray<bool>();
+            for (int i=0; i<valueBs.size(); ++i) 
+                stringValue += (valueBs[i]?"true ":"false ");
+
+            SimTK::Xml::Element elt(prop->getName(), stringValue);
+            aNode.insertNodeAfter(aNode.node_end(), elt);
+        }
+        break;
+    // IntArray
+    case(Property_Deprecated::IntArray) :
+        UpdateXMLNodeArrayProperty<int>(prop,aNode,name);
+        break;
+    // DblArray
+    case(Property_Deprecated::DblArray) :
+        UpdateXMLNodeArrayProperty<double>(prop,aNode,name);
+        break;
+    // DblVec3
+    case(Property_Deprecated::DblVec) :
+        UpdateXMLNodeVec(prop,aNode,name);
+        break;
+    // Transform
+    case(Property_Deprecated::Transform) :
+        UpdateXMLNodeTransform(prop,aNode,name);
+        break;
+    // StrArray
+    case(Property_Deprecated::StrArray) :
+        UpdateXMLNodeArrayProperty<string>(prop,aNode,name);
+        break;
+
+    // NOT RECOGNIZED
+    default :
+        cout<<"Object.UpdateObject: WARN- unrecognized property type."<<endl;
+        break;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // UPDATE OBJECT
 //-----------------------------------------------------------------------------
@@ -792,9 +1006,23 @@ try {
     updateDefaultObjectsFromXMLNode(); // May need to pass in aNode
 
     // LOOP THROUGH PROPERTIES
-    for(int i=0; i < _propertyTable.getNumProperties(); ++i) {
-        AbstractProperty& prop = _propertyTable.updAbstractPropertyByIndex(i);
-        prop.readFromXMLParentElement(aNode, versionNumber);
+    if (versionNumber == XMLDocument::getLatestVersion()) {
+        // Documents at the latest version are laid out as print() writes
+        // them, so the property elements are found with a single pass over
+        // this element's children rather than by searching the children for
+        // each property. Older documents are searched as before.
+        const AbstractProperty::ChildElementIndex children(aNode);
+        for(int i=0; i < _propertyTable.getNumProperties(); ++i) {
+            AbstractProperty& prop =
+                    _propertyTable.updAbstractPropertyByIndex(i);
+            prop.readFromXMLParentElement(aNode, children, versionNumber);
+        }
+    } else {
+        for(int i=0; i < _propertyTable.getNumProperties(); ++i) {
+            AbstractProperty& prop =
+                    _propertyTable.updAbstractPropertyByIndex(i);
+            prop.readFromXMLParentElement(aNode, versionNumber);
+        }
     }
 
     // LOOP THROUGH DEPRECATED PROPERTIES
@@ -1113,78 +1341,9 @@ void Object::updateXMLNode(SimTK::Xml::Element& aParent,
         // TYPE
         Property_Deprecated::PropertyType type = prop->getType();
 
-        // NAME
-        string name = prop->getName();
-
-        string stringValue="";
         // VALUE
         switch(type) {
 
-        // Bool
-        case(Property_Deprecated::Bool) :
-            UpdateXMLNodeSimpleProperty<bool>(prop, myObjectElement, name);
-            break;
-        // Int
-        case(Property_Deprecated::Int) :
-            UpdateXMLNodeSimpleProperty<int>(prop, myObjectElement, name);
-            break;
-        // Dbl
-        case(Property_Deprecated::Dbl) :
-            if (SimTK::isFinite(prop->getValueDbl()))
-                UpdateXMLNodeSimpleProperty<double>(prop, myObjectElement, name);
-            else {
-                if (prop->getValueDbl() == SimTK::Infinity)
-                    stringValue="Inf";
-                else if (prop->getValueDbl() == -SimTK::Infinity)
-                    stringValue="-Inf";
-                else if (SimTK::isNaN(prop->getValueDbl()))
-                    stringValue="NaN";
-                if(!prop->getValueIsDefault()) {
-                    SimTK::Xml::Element elt(prop->getName(), stringValue);
-                    myObjectElement.insertNodeAfter(myObjectElement.node_end(), elt);
-                }
-            } 
-            break;
-        // Str
-        case(Property_Deprecated::Str) :
-            UpdateXMLNodeSimpleProperty<string>(prop, myObjectElement, name);
-            break;
-        // BoolArray
-        case(Property_Deprecated::BoolArray) :
-            // print array as String and add it as such to element
-            //UpdateXMLNodeArrayProperty<bool>(prop,myObjectElement,name); BoolArray Handling on Write
-            stringValue = "";
-            {
-                //int n = prop->getArraySize();
-                const Array<bool> &valueBs = prop->getValueArray<bool>();
-                for (int i=0; i<valueBs.size(); ++i) 
-                    stringValue += (valueBs[i]?"true ":"false ");
-
-                SimTK::Xml::Element elt(prop->getName(), stringValue);
-                myObjectElement.insertNodeAfter(myObjectElement.node_end(), elt);
-            }
-            break;
-        // IntArray
-        case(Property_Deprecated::IntArray) :
-            UpdateXMLNodeArrayProperty<int>(prop,myObjectElement,name);
-            break;
-        // DblArray
-        case(Property_Deprecated::DblArray) :
-            UpdateXMLNodeArrayProperty<double>(prop,myObjectElement,name);
-            break;
-        // DblVec3
-        case(Property_Deprecated::DblVec) :
-            UpdateXMLNodeVec(prop,myObjectElement,name);
-            break;
-        // Transform
-        case(Property_Deprecated::Transform) :
-            UpdateXMLNodeTransform(prop,myObjectElement,name);
-            break;
-        // StrArray
-        case(Property_Deprecated::StrArray) :
-            UpdateXMLNodeArrayProperty<string>(prop,myObjectElement,name);
-            break;
-
         // Obj
         case(Property_Deprecated::Obj) : {
             //PropertyObj *propObj = (PropertyObj*)prop;
@@ -1215,9 +1374,9 @@ void Object::updateXMLNode(SimTK::Xml::Element& aParent,
             } 
             break; 
 
-        // NOT RECOGNIZED
+        // SIMPLE TYPES
         default :
-            cout<<"Object.UpdateObject: WARN- unrecognized property type."<<endl;
+            UpdateXMLNodeSimpleDeprecatedProperty(prop, myObjectElement);
             break;
         }
     }
@@ -1229,6 +1388,110 @@ void Object::updateXMLNode(SimTK::Xml::Element& aParent,
     }
 }
 
+//_____________________________________________________________________________
+/**
+ * Stream the XML element for this object. This must produce the same XML as
+ * updateXMLNode(); only the elements for simple property values are built in
+ * memory.
+ */
+void Object::writeToXMLStream(XMLStreamWriter& writer,
+                              const AbstractProperty* prop) const
+{
+    // Handle non-inlined object
+    if(!getInlined()) {
+        if(IO::GetPrintOfflineDocuments()) {
+            string offlineFileName = getDocumentFileName();
+            _inlined=true;
+            print(offlineFileName);
+            _inlined=false;
+            writer.startElement(getConcreteClassName());
+            writer.addAttribute("file", offlineFileName);
+            writer.endElement();
+        }
+        return;
+    }
+
+    writer.startElement(getConcreteClassName());
+
+    // if property is provided and it is not of unnamed type, use the property name
+    if(prop && prop->isOneObjectProperty() && !prop->isUnnamedProperty()) {
+        writer.addAttribute("name", prop->getName());
+    } // otherwise if object has a name use it as the name value
+    else if (!getName().empty()) {
+        writer.addAttribute("name", getName());
+    }
+
+    // DEFAULT OBJECTS
+    if (_document) _document->writeDefaultObjects(writer);
+
+    // LOOP THROUGH PROPERTIES
+    bool wroteAnyProperties = false;
+    for(int i=0; i < _propertyTable.getNumProperties(); ++i) {
+        const AbstractProperty& prop = _propertyTable.getAbstractPropertyByIndex(i);
+
+        // Don't write out if this is just a default value.
+        if (!prop.getValueIsDefault() || Object::getSerializeAllDefaults()) {
+            prop.writeToXMLStream(writer);
+            wroteAnyProperties = true;
+        }
+    }
+
+    // LOOP THROUGH DEPRECATED PROPERTIES
+    for(int i=0;i<_propertySet.getSize();i++) {
+
+        const Property_Deprecated *prop = _propertySet.get(i);
+        if (prop->getValueIsDefault() && !Object::getSerializeAllDefaults())
+            continue;
+
+        wroteAnyProperties = true;
+
+        // Add comment if any
+        if (!prop->getComment().empty())
+            writer.writeComment(prop->getComment());
+
+        switch(prop->getType()) {
+
+        // Obj
+        case(Property_Deprecated::Obj) :
+            prop->getValueObj().writeToXMLStream(writer);
+            break;
+
+        // ObjArray
+        case(Property_Deprecated::ObjArray) :
+            writer.startElement(prop->getName());
+            for(int j=0;j<prop->getArraySize();j++)
+                prop->getValueObjPtr(j)->writeToXMLStream(writer);
+            writer.endElement();
+            break;
+
+        // ObjPtr
+        case(Property_Deprecated::ObjPtr) :
+            writer.startElement(prop->getName());
+            if (const Object* object = prop->getValueObjPtr())
+                object->writeToXMLStream(writer);
+            writer.endElement();
+            break;
+
+        // SIMPLE TYPES
+        default : {
+            // Build the (small) element for the value, then stream it.
+            SimTK::Xml::Element container("container");
+            UpdateXMLNodeSimpleDeprecatedProperty(prop, container);
+            for (auto it = container.element_begin();
+                    it != container.element_end(); ++it)
+                writer.writeElement(*it);
+            break; }
+        }
+    }
+
+    if (!wroteAnyProperties) {
+        writer.writeComment(
+                "All properties of this object have their default values.");
+    }
+
+    writer.endElement();
+}
+
 //_____________________________________________________________________________
 /**
  * Update the XML node for defaults object.
@@ -1338,6 +1601,88 @@ setAllPropertiesUseDefault(bool aUseDefault)
 //-----------------------------------------------------------------------------
 // PRINT OBJECT
 //-----------------------------------------------------------------------------
+namespace {
+// The file that print() replaces: the target of `fileName` if it is a
+// symbolic link (so that the link is kept), and `fileName` otherwise.
+std::string getFileToReplace(const std::string& fileName) {
+#ifndef _WIN32
+    struct stat info;
+    if (lstat(fileName.c_str(), &info) == 0 && S_ISLNK(info.st_mode)) {
+        char resolved[PATH_MAX];
+        if (realpath(fileName.c_str(), resolved)) return resolved;
+    }
+#endif
+    return fileName;
+}
+
+// Create an empty file with a unique name in the directory of `fileName` and
+// return its name. The file is created only if no file has that name, so
+// existing files and other processes writing the same file are left alone.
+std::string createTemporaryFile(const std::string& fileName) {
+    std::random_device device;
+    std::mt19937 generator(device() ^ (unsigned)std::time(nullptr));
+    for (int attempt = 0; attempt < 100; ++attempt) {
+        std::ostringstream name;
+        name << fileName << "." << std::hex << generator() << ".tmp";
+        const std::string tempFileName = name.str();
+#ifdef _WIN32
+        const int fd = _open(tempFileName.c_str(),
+                _O_CREAT | _O_EXCL | _O_WRONLY, _S_IREAD | _S_IWRITE);
+        if (fd != -1) {
+            _close(fd);
+            return tempFileName;
+        }
+#else
+        const int fd = open(tempFileName.c_str(),
+                O_CREAT | O_EXCL | O_WRONLY, 0666);
+        if (fd != -1) {
+            // Keep the permissions (and, if allowed, the owner) of the file
+            // being replaced.
+            struct stat info;
+            if (stat(fileName.c_str(), &info) == 0) {
+                if (fchown(fd, info.st_uid, info.st_gid) != 0) {
+                    // Only privileged users can change the owner.
+                }
+                fchmod(fd, info.st_mode & 07777);
+            }
+            close(fd);
+            return tempFileName;
+        }
+#endif
+        if (errno != EEXIST) break;
+    }
+    OPENSIM_THROW(Exception,
+            "Could not open a temporary file for writing '" + fileName + "'.");
+}
+
+bool fileExists(const std::string& fileName) {
+#ifdef _WIN32
+    struct _stat info;
+    return _stat(fileName.c_str(), &info) == 0;
+#else
+    struct stat info;
+    return stat(fileName.c_str(), &info) == 0;
+#endif
+}
+
+// Replace `fileName` by `tempFileName` in a single step, so that `fileName`
+// always exists with either its old or its new contents.
+bool replaceFile(const std::string& tempFileName, const std::string& fileName) {
+#ifdef _WIN32
+    // ReplaceFile() keeps the attributes and security settings of the file it
+    // replaces but requires that file to exist.
+    if (ReplaceFileA(fileName.c_str(), tempFileName.c_str(), nullptr,
+                REPLACEFILE_IGNORE_MERGE_ERRORS, nullptr, nullptr)) {
+        return true;
+    }
+    return MoveFileExA(tempFileName.c_str(), fileName.c_str(),
+                   MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return std::rename(tempFileName.c_str(), fileName.c_str()) == 0;
+#endif
+}
+} // anonymous namespace
+
 //_____________________________________________________________________________
 /**
  * Print the object.
@@ -1358,21 +1703,65 @@ print(const string &aFileName) const
         warnBeforePrint();
     }
 
-    {
-        // Temporarily change current directory so that inlined files
-        // are written to correct relative directory
-        IO::CwdChanger cwd = IO::CwdChanger::changeToParentOf(aFileName);
-        std::unique_ptr<XMLDocument> newDoc{new XMLDocument()};
-        if (_document != nullptr) {
-            newDoc->copyDefaultObjects(*_document);
-            delete _document;
-        }
-        _document = newDoc.release();
+    std::unique_ptr<XMLDocument> newDoc{new XMLDocument()};
+    if (_document != nullptr) {
+        newDoc->copyDefaultObjects(*_document);
+        delete _document;
+    }
+    _document = newDoc.release();
+
+    // Printing to standard out is only for debugging, so the document is
+    // built in memory as usual.
+    if (aFileName.empty()) {
         SimTK::Xml::Element e = _document->getRootElement();
         updateXMLNode(e);
+        _document->print(aFileName);
+        return true;
     }
 
-    _document->print(aFileName);
+    // Otherwise, stream the elements to the file without building the
+    // document in memory. The elements are written to a temporary file in
+    // the same directory, which replaces the file only once it is complete,
+    // so that an exception while writing does not leave a truncated file.
+    // The file is opened before changing directories since its name may be
+    // relative to the current directory.
+    const std::string fileToReplace = getFileToReplace(aFileName);
+    const std::string tempFileName = createTemporaryFile(fileToReplace);
+    {
+        std::ofstream stream(tempFileName);
+        if (!stream.good()) {
+            std::remove(tempFileName.c_str());
+            OPENSIM_THROW(Exception,
+                    "Could not open file '" + aFileName + "' for writing.");
+        }
+        try {
+            // Temporarily change current directory so that inlined files
+            // are written to correct relative directory
+            IO::CwdChanger cwd = IO::CwdChanger::changeToParentOf(aFileName);
+            _document->writeToStream(*this, stream);
+            stream.close();
+        } catch (...) {
+            stream.close();
+            std::remove(tempFileName.c_str());
+            throw;
+        }
+        if (stream.fail()) {
+            std::remove(tempFileName.c_str());
+            OPENSIM_THROW(Exception,
+                    "Failed to write to file '" + aFileName + "'.");
+        }
+    }
+    if (!replaceFile(tempFileName, fileToReplace)) {
+        // Keep the new contents unless the file still has the old ones.
+        if (fileExists(fileToReplace)) {
+            std::remove(tempFileName.c_str());
+            OPENSIM_THROW(Exception, "Failed to write to file '" + aFileName +
+                    "': could not replace it.");
+        }
+        OPENSIM_THROW(Exception, "Failed to write to file '" + aFileName +
+                "': could not replace it; its new contents are in '" +
+                tempFileName + "'.");
+    }
     return true;
 }
 
@@ -1667,6 +2056,7 @@ void Object::updateFromXMLDocument()
 
     SimTK::Xml::Element e = _document->getRootDataElement();
     IO::CwdChanger cwd = IO::CwdChanger::changeToParentOf(_document->getFileName());
+    ReadingThreadPoolScope threadPoolScope;
     updateFromXMLNode(e, _document->getDocumentVersion());
 }
 
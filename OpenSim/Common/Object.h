@@ -42,6 +42,7 @@
 
 #include <cstring>
 #include <cassert>
+#include <vector>
 
 // DISABLES MULTIPLE INSTANTIATION WARNINGS
 
@@ -81,6 +82,7 @@ namespace OpenSim {
 const char ObjectDEFAULT_NAME[] = "default";
 
 class XMLDocument;
+class XMLStreamWriter;
 
 //==============================================================================
 //                                 OBJECT
@@ -505,6 +507,17 @@ public:
        (SimTK::Xml::Element& objectElement, 
         int                  versionNumber);
 
+    /** Read each of the given objects from the corresponding element, as
+    readObjectFromXMLNodeOrFile() does; the elements must be siblings (e.g.,
+    the objects in a list property). For documents at the latest version,
+    long lists of inlined objects can be read on multiple threads (see
+    setNumThreadsForReadingXML()); the i-th object is always read from the
+    i-th element. Object list properties use this. **/
+    static void readObjectsFromXMLElements
+       (const std::vector<Object*>&       objects,
+        std::vector<SimTK::Xml::Element>& objectElements,
+        int                               versionNumber);
+
     /** Use this method to deserialize an object from a SimTK::Xml::Element. The 
     element is assumed to be in the format consistent with the passed-in 
     \a versionNumber. If there is a file attribute in \a objectElement it
@@ -528,6 +541,19 @@ public:
     void updateXMLNode(SimTK::Xml::Element& parent,
                        const AbstractProperty* prop=nullptr) const;
 
+    /** Serialize this object by writing its XML element (and the elements of
+    the objects it contains) directly to the given writer, without building
+    an XML document in memory. This produces the same XML as updateXMLNode()
+    and is used by print().
+    @param      writer
+        The object's element is written as a child of the writer's current
+        element.
+    @param      prop (optional)
+        The pointer to the property that contains this object; see
+        updateXMLNode(). **/
+    void writeToXMLStream(XMLStreamWriter& writer,
+                          const AbstractProperty* prop=nullptr) const;
+
     /** Inlined means an in-memory Object that is not associated with
     an XMLDocument. **/
     bool getInlined() const;
@@ -636,6 +662,19 @@ public:
         return _serializeAllDefaults;
     }
 
+    /** Static function to set the number of threads used to read the objects
+    in long object lists (e.g., the muscles in a Model's ForceSet) from files
+    at the latest version; see readObjectsFromXMLElements(). The default, 1,
+    reads all objects on the calling thread; 0 uses the number of hardware
+    threads. Lists in which any object (or an object nested in it) is read
+    from another file are always read on the calling thread. **/
+    static void setNumThreadsForReadingXML(int numThreads);
+    /** Report the number of threads used to read long object lists. **/
+    static int getNumThreadsForReadingXML()
+    {
+        return _numThreadsForReadingXML;
+    }
+
     /** Returns true if the passed-in string is "Object"; each %Object-derived
     class defines a method of this name for its own class name. **/
     static bool isKindOf(const char *type) 
@@ -882,6 +921,9 @@ private:
     // a "defaults" section.
     static bool _serializeAllDefaults;
 
+    // Number of threads for reading long object lists (0: hardware threads).
+    static int _numThreadsForReadingXML;
+
     // The name of this object.
     std::string     _name;
     // A short description of the object.
@@ -1374,6 +1416,8 @@ ObjectProperty<T>::readFromXMLElement
     // by the element's tag; that type must be derived from O or we
     // can't store it in this property.
     int objectsFound = 0;
+    std::vector<Object*> objects;
+    std::vector<SimTK::Xml::Element> objectElements;
     SimTK::Xml::element_iterator iter = propertyElement.element_begin();
     for (; iter != propertyElement.element_end(); ++iter) {
         const SimTK::String& objTypeTag = iter->getElementTag();
@@ -1405,8 +1449,14 @@ ObjectProperty<T>::readFromXMLElement
         // Create an Object of the element tag's type.
         Object* object = Object::newInstanceOfType(objTypeTag);
         assert(object); // we just checked above
-        object->readObjectFromXMLNodeOrFile(*iter, versionNumber);
+        objects.push_back(object);
+        objectElements.push_back(*iter);
+    }
 
+    // Read the objects (possibly in parallel), then append them in the order
+    // in which they appear in the file.
+    Object::readObjectsFromXMLElements(objects, objectElements, versionNumber);
+    for (Object* object : objects) {
         T* objectT = dynamic_cast<T*>(object);
         assert(objectT); // should have worked by construction
         adoptAndAppendValueVirtual(objectT); // don't copy
@@ -400,14 +400,23 @@ int PiecewiseConstantFunction::addPoint(double aX, double aY)
 }
 
 double PiecewiseConstantFunction::calcValue(const Vector& x) const
+{
+    return calcValueAndDerivatives(x[0], 0)[0];
+}
+
+double PiecewiseConstantFunction::calcDerivative(const std::vector<int>& derivComponents, const Vector& x) const
+{
+    return 0.0;
+}
+
+SimTK::Vec3 PiecewiseConstantFunction::calcValueAndDerivatives(double aX, int maxDerivOrder) const
 {
     int n = _x.getSize();
-    double aX = x[0];
 
     if (aX < _x[0] || EQUAL_WITHIN_ERROR(aX,_x[0]))
-        return _y[0];
+        return SimTK::Vec3(_y[0], 0, 0);
     if (aX > _x[n-1] || EQUAL_WITHIN_ERROR(aX,_x[n-1]))
-        return _y[n-1];
+        return SimTK::Vec3(_y[n-1], 0, 0);
 
    // Do a binary search to find which two points the abscissa is between.
     int k, i = 0;
@@ -423,12 +432,7 @@ double PiecewiseConstantFunction::calcValue(const Vector& x) const
             break;
     }
 
-    return _y[k];
-}
-
-double PiecewiseConstantFunction::calcDerivative(const std::vector<int>& derivComponents, const Vector& x) const
-{
-    return 0.0;
+    return SimTK::Vec3(_y[k], 0, 0);
 }
 
 int PiecewiseConstantFunction::getArgumentSize() const
@@ -429,38 +429,7 @@ void PiecewiseLinearFunction::calcCoefficients()
 
 double PiecewiseLinearFunction::calcValue(const Vector& x) const
 {
-    int n = _x.getSize();
-    double aX = x[0];
-
-    if (aX < _x[0])
-        return _y[0] + (aX - _x[0]) * _b[0];
-    else if (aX > _x[n-1])
-        return _y[n-1] + (aX - _x[n-1]) * _b[n-1];
-
-    /* Check to see if the abscissa is close to one of the end points
-     * (the binary search method doesn't work well if you are at one of the
-     * end points.
-     */
-    if (EQUAL_WITHIN_ERROR(aX, _x[0]))
-        return _y[0];
-    else if (EQUAL_WITHIN_ERROR(aX,_x[n-1]))
-        return _y[n-1];
-
-    // Do a binary search to find which two points the abscissa is between.
-    int k, i = 0;
-    int j = n;
-    while (1)
-    {
-        k = (i+j)/2;
-        if (aX < _x[k])
-            j = k;
-        else if (aX > _x[k+1])
-            i = k;
-        else
-            break;
-    }
-
-    return _y[k] + (aX - _x[k]) * _b[k];
+    return calcValueAndDerivatives(x[0], 0)[0];
 }
 
 double PiecewiseLinearFunction::calcDerivative(const std::vector<int>& derivComponents, const Vector& x) const
@@ -470,24 +439,26 @@ double PiecewiseLinearFunction::calcDerivative(const std::vector<int>& derivComp
     if (derivComponents.size() > 1)
         return 0.0;
 
+    return calcValueAndDerivatives(x[0], 1)[1];
+}
+
+SimTK::Vec3 PiecewiseLinearFunction::calcValueAndDerivatives(double aX, int maxDerivOrder) const
+{
     int n = _x.getSize();
-    double aX = x[0];
 
-    if (aX < _x[0]) {
-        return _b[0];
-    } else if (aX > _x[n-1]) {
-        return _b[n-1];
-    }
+    if (aX < _x[0])
+        return SimTK::Vec3(_y[0] + (aX - _x[0]) * _b[0], _b[0], 0);
+    else if (aX > _x[n-1])
+        return SimTK::Vec3(_y[n-1] + (aX - _x[n-1]) * _b[n-1], _b[n-1], 0);
 
     /* Check to see if the abscissa is close to one of the end points
      * (the binary search method doesn't work well if you are at one of the
      * end points.
      */
-    if (EQUAL_WITHIN_ERROR(aX, _x[0])) {
-        return _b[0];
-    } else if (EQUAL_WITHIN_ERROR(aX,_x[n-1])) {
-        return _b[n-1];
-    }
+    if (EQUAL_WITHIN_ERROR(aX, _x[0]))
+        return SimTK::Vec3(_y[0], _b[0], 0);
+    else if (EQUAL_WITHIN_ERROR(aX,_x[n-1]))
+        return SimTK::Vec3(_y[n-1], _b[n-1], 0);
 
     // Do a binary search to find which two points the abscissa is between.
     int k, i = 0;
@@ -503,7 +474,7 @@ double PiecewiseLinearFunction::calcDerivative(const std::vector<int>& derivComp
             break;
     }
 
-    return _b[k];
+    return SimTK::Vec3(_y[k] + (aX - _x[k]) * _b[k], _b[k], 0);
 }
 
 int PiecewiseLinearFunction::getArgumentSize() const
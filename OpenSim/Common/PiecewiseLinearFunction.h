@@ -116,6 +116,8 @@ public:
     //--------------------------------------------------------------------------
     double calcValue(const SimTK::Vector& x) const override;
     double calcDerivative(const std::vector<int>& derivComponents, const SimTK::Vector& x) const override;
+    SimTK::Vec3 calcValueAndDerivatives(double x, int maxDerivOrder = 2) const override;
+    bool hasFastValueAndDerivatives() const override { return true; }
     int getArgumentSize() const override;
     int getMaxDerivativeOrder() const override;
     SimTK::Function* createSimTKFunction() const override;
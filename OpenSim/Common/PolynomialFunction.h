@@ -100,6 +100,21 @@ public:
         return new SimTK::Function::Polynomial(get_coefficients());
     }
 
+    /** Evaluate the polynomial and its derivatives with Horner's method. */
+    SimTK::Vec3 calcValueAndDerivatives(double x,
+            int maxDerivOrder = 2) const override
+    {
+        const SimTK::Vector& coefficients = get_coefficients();
+        double value = 0, deriv1 = 0, deriv2 = 0;
+        for (int i = 0; i < coefficients.size(); ++i) {
+            deriv2 = deriv2*x + 2*deriv1;
+            deriv1 = deriv1*x + value;
+            value = value*x + coefficients[i];
+        }
+        return SimTK::Vec3(value, deriv1, deriv2);
+    }
+    bool hasFastValueAndDerivatives() const override { return true; }
+
 private:
     /**
     * Construct the serializable property member variables and
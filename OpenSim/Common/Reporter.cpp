@@ -40,9 +40,11 @@ public:
         // This should be triggered every (interval) time units.
         SimTK_ASSERT(state.getTime() == getNextEventTime(state, true),
             "Reporter did not report at specified time interval.");
-        // Guarantee that the system is at the reporting stage
-        if (state.getSystemStage() < SimTK::Stage::Report) {
-            _system.realize(state, SimTK::Stage::Report);
+        // Guarantee that the system is realized to the stage required by
+        // the reported quantities; avoid realizing further than necessary.
+        const SimTK::Stage& requiredStage = _owner.getRequiredStage();
+        if (state.getSystemStage() < requiredStage) {
+            _system.realize(state, requiredStage);
         }
         // delegate back to the OpenSim::Reporter to do the reporting
         _owner.report(state);
@@ -60,6 +60,14 @@ public:
     /** Report values given the state and top-level Component (e.g. Model) */
     void report(const SimTK::State& s) const;
 
+    /** The highest realization stage on which the reported quantities
+    depend. When reporting periodically (report_time_interval > 0), the State
+    is only realized to this stage before reporting, so that, for example,
+    reporting only Position-stage outputs does not require computing
+    accelerations. This is determined from the connected outputs when
+    connections are finalized; before then, it is SimTK::Stage::Report. */
+    const SimTK::Stage& getRequiredStage() const { return _requiredStage; }
+
 protected:
     /** Default constructor sets up Reporter-level properties; can only be
     called from a derived class constructor. **/
@@ -85,10 +93,18 @@ protected:
      report_time_interval is 0.  */
     void extendRealizeReport(const SimTK::State& state) const override final;
 
+    /** Set the stage returned by getRequiredStage(). Concrete reporters set
+    this from the dependsOnStage of the outputs they report. */
+    void setRequiredStage(const SimTK::Stage& stage) {
+        _requiredStage = stage;
+    }
+
 private:
     void setNull();
     void constructProperties();
 
+    SimTK::Stage _requiredStage{SimTK::Stage::Report};
+
 //=============================================================================
 };  // END of class AbstractReporter
 //=============================================================================
@@ -156,6 +172,20 @@ protected:
     called from a derived class constructor. **/
     Reporter() = default;
     virtual ~Reporter() = default;
+
+    /** Determine the stage required for reporting from the outputs connected
+    to the "inputs" Input. */
+    void extendFinalizeConnections(Component& root) override {
+        Super::extendFinalizeConnections(root);
+
+        const auto& input = this->template getInput<InputT>("inputs");
+        SimTK::Stage requiredStage = SimTK::Stage::Time;
+        for (const auto& chan : input.getChannels()) {
+            const auto& stage = chan->getOutput().getDependsOnStage();
+            if (stage > requiredStage) requiredStage = stage;
+        }
+        this->setRequiredStage(requiredStage);
+    }
     //=============================================================================
 };  // END of class Reporter<InputT>
     //=============================================================================
@@ -205,17 +235,16 @@ public:
 protected:
     void implementReport(const SimTK::State& state) const override {
         const auto& input = this->template getInput<InputT>("inputs");
-        SimTK::RowVector_<ValueT> result;
-        result.resize(int(input.getNumConnectees()));
-
-        for (auto idx = 0u; idx < input.getNumConnectees(); ++idx) {
-              const auto& chan = input.getChannel(idx);
-              const auto& value = chan.getValue(state);
-              result[idx] = value;
+        // Read all channels into a row buffer that is reused across reports
+        // to avoid allocating a new row every report.
+        const auto& channels = input.getChannels();
+        _rowBuffer.resize(int(channels.size()));
+        for (int idx = 0; idx < _rowBuffer.size(); ++idx) {
+            _rowBuffer[idx] = channels[idx]->getValue(state);
         }
         try {
             const_cast<Self*>(this)->_outputTable.appendRow(state.getTime(),
-                                                            result);
+                                                            _rowBuffer);
         } catch(const InvalidTimestamp& exception) {
             OPENSIM_THROW(Exception,
                           "Attempting to update reporter with rows having "
@@ -251,6 +280,9 @@ private:
     // We write to this table in const methods, but only because we ensure
     // those const methods are never called with trial integrator states.
     TimeSeriesTable_<ValueT> _outputTable;
+
+    // Holds the values of one row while reporting.
+    mutable SimTK::RowVector_<ValueT> _rowBuffer;
 };
 
 /** A reporter that simply prints quantities to the console
@@ -27,7 +27,8 @@
 #include "Constant.h"
 #include "SimmMacros.h"
 #include "XYFunctionInterface.h"
-#include "FunctionAdapter.h"
+
+#include <vector>
 
 
 using namespace OpenSim;
@@ -508,90 +509,43 @@ int SimmSpline::addPoint(double aX, double aY)
     return i;
 }
 
-double SimmSpline::calcValue(const Vector& x) const
-{
-    // NOT A NUMBER
-    if(!_y.getSize()) return(SimTK::NaN);
-    if(!_b.getSize()) return(SimTK::NaN);
-    if(!_c.getSize()) return(SimTK::NaN);
-    if(!_d.getSize()) return(SimTK::NaN);
-
-    int i, j, k;
-    double dx;
-
-    int n = _x.getSize();
-    double aX = x[0];
-
-   /* Check if the abscissa is out of range of the function. If it is,
-    * then use the slope of the function at the appropriate end point to
-    * extrapolate. You do this rather than printing an error because the
-    * assumption is that this will only occur in relatively harmless
-    * situations (like a motion file that contains an out-of-range coordinate
-    * value). The rest of the SIMM code has many checks to clamp a coordinate
-    * value within its range of motion, so if you make it to this function
-    * and the coordinate is still out of range, deal with it quietly.
-    */
-
-   if (aX < _x[0])
-       return _y[0] + (aX - _x[0])*_b[0];
-   else if (aX > _x[n-1])
-       return _y[n-1] + (aX - _x[n-1])*_b[n-1];
-
-   /* Check to see if the abscissa is close to one of the end points
-    * (the binary search method doesn't work well if you are at one of the
-    * end points.
-    */
-   if (EQUAL_WITHIN_ERROR(aX,_x[0]))
-       return _y[0];
-   else if (EQUAL_WITHIN_ERROR(aX,_x[n-1]))
-       return _y[n-1];
-
-    if (n < 3)
-    {
+//=============================================================================
+// EVALUATION
+//=============================================================================
+namespace {
+// These kernels operate on raw coefficient arrays so that SimmSpline and the
+// SimTK::Function created by SimmSpline::createSimTKFunction() share a single
+// implementation (and produce identical results).
+
+/* Find the interval [x[k], x[k+1]] that contains aX, assuming aX is strictly
+ * within (x[0], x[n-1]). */
+inline int findSimmSplineInterval(int n, const double* x, double aX) {
+    if (n < 3) {
         /* If there are only 2 function points, then set k to zero
          * (you've already checked to see if the abscissa is out of
          * range or equal to one of the endpoints).
          */
-        k = 0;
+        return 0;
     }
-    else
+    /* Do a binary search to find which two points the abscissa is between. */
+    int i = 0;
+    int j = n;
+    int k;
+    while (1)
     {
-        /* Do a binary search to find which two points the abscissa is between. */
-        i = 0;
-        j = n;
-        while (1)
-        {
-            k = (i+j)/2;
-            if (aX < _x[k])
-                j = k;
-            else if (aX > _x[k+1])
-                i = k;
-            else
-                break;
-        }
+        k = (i+j)/2;
+        if (aX < x[k])
+            j = k;
+        else if (aX > x[k+1])
+            i = k;
+        else
+            break;
     }
-
-   dx = aX - _x[k];
-   return _y[k] + dx*(_b[k] + dx*(_c[k] + dx*_d[k]));
+    return k;
 }
 
-double SimmSpline::calcDerivative(const std::vector<int>& derivComponents, const Vector& x) const
-{
-    // NOT A NUMBER
-    if(!_y.getSize()) return(SimTK::NaN);
-    if(!_b.getSize()) return(SimTK::NaN);
-    if(!_c.getSize()) return(SimTK::NaN);
-    if(!_d.getSize()) return(SimTK::NaN);
-
-    int i, j, k;
-    double dx;
-
-    int n = _x.getSize();
-    double aX = x[0];
-    int aDerivOrder = (int)derivComponents.size();
-    if (aDerivOrder < 1 || aDerivOrder > 2)
-        throw Exception("SimmSpline::calcDerivative(): derivative order must be 1 or 2.");
-
+inline double calcSimmSplineValue(int n, const double* x, const double* y,
+        const double* b, const double* c, const double* d, double aX) {
    /* Check if the abscissa is out of range of the function. If it is,
     * then use the slope of the function at the appropriate end point to
     * extrapolate. You do this rather than printing an error because the
@@ -602,17 +556,41 @@ double SimmSpline::calcDerivative(const std::vector<int>& derivComponents, const
     * and the coordinate is still out of range, deal with it quietly.
     */
 
-   if (aX < _x[0])
+   if (aX < x[0])
+       return y[0] + (aX - x[0])*b[0];
+   else if (aX > x[n-1])
+       return y[n-1] + (aX - x[n-1])*b[n-1];
+
+   /* Check to see if the abscissa is close to one of the end points
+    * (the binary search method doesn't work well if you are at one of the
+    * end points.
+    */
+   if (EQUAL_WITHIN_ERROR(aX,x[0]))
+       return y[0];
+   else if (EQUAL_WITHIN_ERROR(aX,x[n-1]))
+       return y[n-1];
+
+   const int k = findSimmSplineInterval(n, x, aX);
+   const double dx = aX - x[k];
+   return y[k] + dx*(b[k] + dx*(c[k] + dx*d[k]));
+}
+
+/* aDerivOrder must be 1 or 2. */
+inline double calcSimmSplineDerivative(int n, const double* x,
+        const double* b, const double* c, const double* d, int aDerivOrder,
+        double aX) {
+   // See calcSimmSplineValue() regarding extrapolation.
+   if (aX < x[0])
    {
       if (aDerivOrder == 1)
-         return _b[0];
+         return b[0];
       else
          return 0;
    }
-   else if (aX > _x[n-1])
+   else if (aX > x[n-1])
    {
       if (aDerivOrder == 1)
-         return _b[n-1];
+         return b[n-1];
       else
          return 0;
    }
@@ -621,53 +599,141 @@ double SimmSpline::calcDerivative(const std::vector<int>& derivComponents, const
     * (the binary search method doesn't work well if you are at one of the
     * end points.
     */
-   if (EQUAL_WITHIN_ERROR(aX,_x[0]))
+   if (EQUAL_WITHIN_ERROR(aX,x[0]))
    {
       if (aDerivOrder == 1)
-         return _b[0];
+         return b[0];
       else
-         return 2.0*_c[0];
+         return 2.0*c[0];
    }
-   else if (EQUAL_WITHIN_ERROR(aX,_x[n-1]))
+   else if (EQUAL_WITHIN_ERROR(aX,x[n-1]))
    {
       if (aDerivOrder == 1)
-         return _b[n-1];
+         return b[n-1];
       else
-         return 2.0*_c[n-1];
+         return 2.0*c[n-1];
    }
 
-    if (n < 3)
-    {
-        /* If there are only 2 function points, then set k to zero
-         * (you've already checked to see if the abscissa is out of
-         * range or equal to one of the endpoints).
-         */
-        k = 0;
+   const int k = findSimmSplineInterval(n, x, aX);
+   const double dx = aX - x[k];
+
+   if (aDerivOrder == 1)
+      return (b[k] + dx*(2.0*c[k] + 3.0*dx*d[k]));
+
+   else
+      return (2.0*c[k] + 6.0*dx*d[k]);
+}
+
+/* The value and the first and second derivatives, locating the interval only
+ * once. The results are identical to those of the kernels above. */
+inline SimTK::Vec3 calcSimmSplineValueAndDerivatives(int n, const double* x,
+        const double* y, const double* b, const double* c, const double* d,
+        double aX) {
+   // See calcSimmSplineValue() regarding extrapolation.
+   if (aX < x[0])
+       return SimTK::Vec3(y[0] + (aX - x[0])*b[0], b[0], 0);
+   else if (aX > x[n-1])
+       return SimTK::Vec3(y[n-1] + (aX - x[n-1])*b[n-1], b[n-1], 0);
+
+   if (EQUAL_WITHIN_ERROR(aX,x[0]))
+       return SimTK::Vec3(y[0], b[0], 2.0*c[0]);
+   else if (EQUAL_WITHIN_ERROR(aX,x[n-1]))
+       return SimTK::Vec3(y[n-1], b[n-1], 2.0*c[n-1]);
+
+   const int k = findSimmSplineInterval(n, x, aX);
+   const double dx = aX - x[k];
+   return SimTK::Vec3(y[k] + dx*(b[k] + dx*(c[k] + dx*d[k])),
+           b[k] + dx*(2.0*c[k] + 3.0*dx*d[k]),
+           2.0*c[k] + 6.0*dx*d[k]);
+}
+
+/* The SimTK::Function used by CustomJoint (and others) for a SimmSpline.
+ * Unlike FunctionAdapter, this holds its own copy of the spline coefficients
+ * and evaluates them directly, avoiding the virtual call into the
+ * OpenSim::Function and the conversion of the derivative components to a
+ * std::vector on every call. */
+class SimTKSimmSpline : public SimTK::Function {
+public:
+    SimTKSimmSpline(const Array<double>& aX, const Array<double>& aY,
+            const Array<double>& aB, const Array<double>& aC,
+            const Array<double>& aD)
+            : x(aX.get(), aX.get() + aX.getSize()),
+              y(aY.get(), aY.get() + aY.getSize()),
+              b(aB.get(), aB.get() + aB.getSize()),
+              c(aC.get(), aC.get() + aC.getSize()),
+              d(aD.get(), aD.get() + aD.getSize()) {}
+    double calcValue(const SimTK::Vector& arg) const override {
+        if (!isValid()) return SimTK::NaN;
+        return calcSimmSplineValue((int)x.size(), x.data(), y.data(),
+                b.data(), c.data(), d.data(), arg[0]);
     }
-    else
-    {
-        /* Do a binary search to find which two points the abscissa is between. */
-        i = 0;
-        j = n;
-        while (1)
-        {
-            k = (i+j)/2;
-            if (aX < _x[k])
-                j = k;
-            else if (aX > _x[k+1])
-                i = k;
-            else
-                break;
-        }
+    double calcDerivative(const SimTK::Array_<int>& derivComponents,
+            const SimTK::Vector& arg) const override {
+        if (!isValid()) return SimTK::NaN;
+        const int order = (int)derivComponents.size();
+        if (order < 1 || order > 2)
+            throw Exception("SimmSpline::calcDerivative(): derivative "
+                            "order must be 1 or 2.");
+        return calcSimmSplineDerivative((int)x.size(), x.data(), b.data(),
+                c.data(), d.data(), order, arg[0]);
+    }
+    int getArgumentSize() const override { return 1; }
+    int getMaxDerivativeOrder() const override { return 2; }
+    SimTKSimmSpline* clone() const override {
+        return new SimTKSimmSpline(*this);
     }
 
-   dx = aX - _x[k];
+private:
+    bool isValid() const {
+        return !y.empty() && !b.empty() && !c.empty() && !d.empty();
+    }
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> b;
+    std::vector<double> c;
+    std::vector<double> d;
+};
+} // anonymous namespace
 
-   if (aDerivOrder == 1)
-      return (_b[k] + dx*(2.0*_c[k] + 3.0*dx*_d[k]));
+double SimmSpline::calcValue(const Vector& x) const
+{
+    // NOT A NUMBER
+    if(!_y.getSize()) return(SimTK::NaN);
+    if(!_b.getSize()) return(SimTK::NaN);
+    if(!_c.getSize()) return(SimTK::NaN);
+    if(!_d.getSize()) return(SimTK::NaN);
 
-   else
-      return (2.0*_c[k] + 6.0*dx*_d[k]);
+    return calcSimmSplineValue(_x.getSize(), _x.get(), _y.get(), _b.get(),
+            _c.get(), _d.get(), x[0]);
+}
+
+double SimmSpline::calcDerivative(const std::vector<int>& derivComponents, const Vector& x) const
+{
+    // NOT A NUMBER
+    if(!_y.getSize()) return(SimTK::NaN);
+    if(!_b.getSize()) return(SimTK::NaN);
+    if(!_c.getSize()) return(SimTK::NaN);
+    if(!_d.getSize()) return(SimTK::NaN);
+
+    int aDerivOrder = (int)derivComponents.size();
+    if (aDerivOrder < 1 || aDerivOrder > 2)
+        throw Exception("SimmSpline::calcDerivative(): derivative order must be 1 or 2.");
+
+    return calcSimmSplineDerivative(_x.getSize(), _x.get(), _b.get(),
+            _c.get(), _d.get(), aDerivOrder, x[0]);
+}
+
+SimTK::Vec3 SimmSpline::calcValueAndDerivatives(double x,
+        int maxDerivOrder) const
+{
+    // NOT A NUMBER
+    if(!_y.getSize()) return SimTK::Vec3(SimTK::NaN);
+    if(!_b.getSize()) return SimTK::Vec3(SimTK::NaN);
+    if(!_c.getSize()) return SimTK::Vec3(SimTK::NaN);
+    if(!_d.getSize()) return SimTK::Vec3(SimTK::NaN);
+
+    return calcSimmSplineValueAndDerivatives(_x.getSize(), _x.get(), _y.get(),
+            _b.get(), _c.get(), _d.get(), x);
 }
 
 int SimmSpline::getArgumentSize() const
@@ -681,5 +747,7 @@ int SimmSpline::getMaxDerivativeOrder() const
 }
 
 SimTK::Function* SimmSpline::createSimTKFunction() const {
-    return new FunctionAdapter(*this);
+    // The returned function holds a copy of the current coefficients; it
+    // does not reflect later edits to this spline.
+    return new SimTKSimmSpline(_x, _y, _b, _c, _d);
 }
@@ -97,6 +97,21 @@ public:
             sin(get_omega()*x[0] + get_phase() + n*SimTK::Pi/2);
     }
 
+    SimTK::Vec3 calcValueAndDerivatives(double x,
+            int maxDerivOrder = 2) const override {
+        const double amplitude = get_amplitude();
+        const double omega = get_omega();
+        const double arg = omega*x + get_phase();
+        SimTK::Vec3 result(amplitude*sin(arg) + get_offset(),
+                SimTK::NaN, SimTK::NaN);
+        if (maxDerivOrder >= 1)
+            result[1] = amplitude*omega*sin(arg + SimTK::Pi/2);
+        if (maxDerivOrder >= 2)
+            result[2] = amplitude*pow(omega, 2)*sin(arg + 2*SimTK::Pi/2);
+        return result;
+    }
+    bool hasFastValueAndDerivatives() const override { return true; }
+
     SimTK::Function* createSimTKFunction() const override {
         return new FunctionAdapter(*this);
     }
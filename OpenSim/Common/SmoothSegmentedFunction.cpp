@@ -24,6 +24,7 @@
 // INCLUDES
 //=============================================================================
 #include "SmoothSegmentedFunction.h"
+#include <algorithm>
 #include <fstream>
 #include "simmath/internal/SplineFitter.h"
 
@@ -296,6 +297,36 @@ double SmoothSegmentedFunction::calcDerivative(double x, int order) const
 
 
 
+SimTK::Vec3 SmoothSegmentedFunction::calcValueAndDerivatives(double x,
+        int maxDerivOrder) const
+{
+    SimTK::Vec3 result(SimTK::NaN);
+    if(x >= _x0 && x <= _x1){
+        int idx  = SegmentedQuinticBezierToolkit::calcIndex(x,_mXVec);
+        double u = SegmentedQuinticBezierToolkit::
+                        calcU(x,_mXVec[idx], _arraySplineUX[idx],
+                        UTOL,MAXITER);
+        result[0] = SegmentedQuinticBezierToolkit::
+                        calcQuinticBezierCurveVal(u,_mYVec[idx]);
+        for(int order = 1; order <= std::min(maxDerivOrder, 2); ++order){
+            result[order] = SegmentedQuinticBezierToolkit::
+                        calcQuinticBezierCurveDerivDYDX(u, _mXVec[idx],
+                        _mYVec[idx], order);
+        }
+    }else{
+        if(x < _x0){
+            result[0] = _y0 + _dydx0*(x-_x0);
+            result[1] = _dydx0;
+        }else{
+            result[0] = _y1 + _dydx1*(x-_x1);
+            result[1] = _dydx1;
+        }
+        result[2] = 0;
+    }
+
+    return result;
+}
+
 double SmoothSegmentedFunction::
     calcDerivative(const SimTK::Array_<int>& derivComponents,
                  const SimTK::Vector& ax) const
@@ -122,6 +122,22 @@ namespace OpenSim {
        */
        double calcDerivative(double x, int order) const;       
 
+       /**Calculates the value and the first and second derivatives of the
+       curve this object represents. This is cheaper than calling calcValue()
+       and calcDerivative() separately, since the Bezier curve parameter u
+       corresponding to x is computed only once.
+
+       @param x             The domain point of interest.
+
+       @param maxDerivOrder The highest derivative needed (0, 1, or 2).
+                            Derivatives above this order may not be
+                            computed, and their values are unspecified.
+
+       @return The value, dy/dx, and d^2y/dx^2 evaluated at x
+       */
+       SimTK::Vec3 calcValueAndDerivatives(double x,
+               int maxDerivOrder = 2) const;
+
 #ifndef SWIG
        /// Allow the more general calcDerivative from the base class to be used.
        // This helps avoid the -Woverloaded-virtual warning with Clang.
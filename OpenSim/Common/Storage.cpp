@@ -41,6 +41,7 @@
 #include "StateVector.h"
 #include "TableUtilities.h"
 #include "TimeSeriesTable.h"
+#include <algorithm>
 #include <iostream>
 
 using namespace OpenSim;
@@ -50,10 +51,12 @@ void convertTableToStorage(const AbstractDataTable* table, Storage& sto)
 {
     sto.purge();
     TimeSeriesTable out;
+    // The table to copy from; a TimeSeriesTable is read directly.
+    const TimeSeriesTable* source = &out;
 
     if (auto td = dynamic_cast<const TimeSeriesTable*>(table))
-        // Table is already flattened, so clone for further processing
-        out = TimeSeriesTable{ *td };
+        // Table is already flattened, so no copy is needed.
+        source = td;
     else if (auto tst = dynamic_cast<const TimeSeriesTable_<SimTK::Vec2>*>(table))
         out = tst->flatten();
     else if (auto tst = dynamic_cast<const TimeSeriesTable_<SimTK::Vec3>*>(table))
@@ -86,18 +89,26 @@ void convertTableToStorage(const AbstractDataTable* table, Storage& sto)
         OPENSIM_THROW( STODataTypeNotSupported, typeid(table).name());
     }
 
-    OpenSim::Array<std::string> labels("", (int)out.getNumColumns() + 1);
+    const int nc = (int)source->getNumColumns();
+    const int nr = (int)source->getNumRows();
+    OpenSim::Array<std::string> labels("", nc + 1);
     labels[0] = "time";
-    for (int i = 0; i < (int)out.getNumColumns(); ++i) {
-        labels[i + 1] = out.getColumnLabel(i);
+    for (int i = 0; i < nc; ++i) {
+        labels[i + 1] = source->getColumnLabel(i);
     }
     sto.setColumnLabels(labels);
 
-    const auto& times = out.getIndependentColumn();
-    for (unsigned i_time = 0; i_time < out.getNumRows(); ++i_time) {
-        const SimTK::Vector rowVector =
-            out.getRowAtIndex(i_time).transpose().getAsVector();
-        sto.append(times[i_time], rowVector);
+    // Copy each row of the matrix straight into a StateVector, without
+    // creating a temporary row vector.
+    const auto& times = source->getIndependentColumn();
+    const auto& matrix = source->getMatrix();
+    StateVector vec;
+    Array<double>& data = vec.getData();
+    data.setSize(nc);
+    for (int i_time = 0; i_time < nr; ++i_time) {
+        vec.setTime(times[i_time]);
+        for (int j = 0; j < nc; ++j) data[j] = matrix(i_time, j);
+        sto.append(vec);
     }
 }
 
@@ -1330,30 +1341,51 @@ Storage::getColumnIndicesForIdentifier(const std::string& identifier) const
 }
 
 TimeSeriesTable Storage::exportToTable() const {
-    TimeSeriesTable table{};
-
-    table.addTableMetaData("header", getName());
-    table.addTableMetaData("inDegrees", std::string{_inDegrees ? "yes" : "no"});
-    table.addTableMetaData("nRows", std::to_string(_storage.getSize()));
-    table.addTableMetaData("nColumns", std::to_string(_columnLabels.getSize()));
-    if(!getDescription().empty())
-        table.addTableMetaData("description", getDescription());
+    const int nr = _storage.getSize();
 
     // Exclude the first column label. It is 'time'. Time is a separate column
     // in TimeSeriesTable and column label is optional.
+    std::vector<std::string> labels;
     if (_columnLabels.size() > 1) {
-        table.setColumnLabels(_columnLabels.get() + 1,
+        labels.assign(_columnLabels.get() + 1,
                 _columnLabels.get() + _columnLabels.getSize());
     }
+    const int nc = (int)labels.size();
+    bool rowsMatchLabels = nc > 0;
+    for (int i = 0; rowsMatchLabels && i < nr; ++i)
+        rowsMatchLabels = _storage[i].getSize() == nc;
 
-    for(int i = 0; i < _storage.getSize(); ++i) {
-        const auto& row = getStateVector(i)->getData();
-        const auto time = getStateVector(i)->getTime();
-        // Exclude the first column. It is 'time'. Time is a separate column in
-        // TimeSeriesTable.
-        table.appendRow(time, row.get(), row.get() + row.getSize());
+    TimeSeriesTable table{};
+    if (rowsMatchLabels) {
+        // Fill the times and the matrix in one pass and construct the table
+        // from them; appending row by row reallocates the matrix every row.
+        std::vector<double> times(nr);
+        SimTK::Matrix data(nr, nc);
+        for (int i = 0; i < nr; ++i) {
+            const StateVector& vec = _storage[i];
+            times[i] = vec.getTime();
+            const double* row = vec.getData().get();
+            for (int j = 0; j < nc; ++j) data(i, j) = row[j];
+        }
+        table = TimeSeriesTable(times, data, labels);
+    } else {
+        // Without labels (or with rows of differing sizes), let appendRow()
+        // determine (and validate) the number of columns.
+        if (nc > 0) table.setColumnLabels(labels.begin(), labels.end());
+        for (int i = 0; i < nr; ++i) {
+            const auto& row = _storage[i].getData();
+            table.appendRow(_storage[i].getTime(), row.get(),
+                    row.get() + row.getSize());
+        }
     }
 
+    table.addTableMetaData("header", getName());
+    table.addTableMetaData("inDegrees", std::string{_inDegrees ? "yes" : "no"});
+    table.addTableMetaData("nRows", std::to_string(nr));
+    table.addTableMetaData("nColumns", std::to_string(_columnLabels.getSize()));
+    if(!getDescription().empty())
+        table.addTableMetaData("description", getDescription());
+
     return table;
 }
 
@@ -2323,33 +2355,26 @@ void Storage::
 pad(int aPadSize)
 {
     if (aPadSize==0) return; //Nothing to do
+    ColumnData columns;
+    gatherColumns(columns);
+    int size = columns.numRows;
+
     // PAD THE TIME COLUMN
-    Array<double> paddedTime;
-    int size = getTimeColumn(paddedTime);
-    Signal::Pad(aPadSize,paddedTime);
-    int newSize = paddedTime.getSize();
+    ColumnData padded;
+    padded.times = Signal::Pad(aPadSize,size,columns.times.data());
+    padded.numRows = (int)padded.times.size();
+    padded.numColumns = columns.numColumns;
+    padded.values.resize((std::size_t)padded.numRows*padded.numColumns);
 
     // PAD EACH COLUMN
-    int nc = getSmallestNumberOfStates();
-    Array<double> paddedSignal(0.0,size);
-    StateVector *vecs = new StateVector[newSize];
-    for(int j=0;j<newSize;j++) {
-        vecs[j].getData().setSize(nc);
-        vecs[j].setTime(paddedTime[j]);
-    }
-    for(int i=0;i<nc;i++) {
-        getDataColumn(i,paddedSignal);
-        Signal::Pad(aPadSize,paddedSignal);
-        for(int j=0;j<newSize;j++)
-            vecs[j].setDataValue(i,paddedSignal[j]);
+    for(int i=0;i<columns.numColumns;i++) {
+        std::vector<double> paddedSignal =
+                Signal::Pad(aPadSize,size,columns.getColumn(i));
+        std::copy(paddedSignal.begin(),paddedSignal.end(),padded.updColumn(i));
     }
 
-    // APPEND THE STATEVECTORS
-    _storage.setSize(0);
-    for(int i=0;i<newSize;i++) _storage.append(vecs[i]);
-
-    // CLEANUP
-    delete[] vecs;
+    // REPLACE THE STATEVECTORS
+    setRowsFromColumns(padded);
 }
 
 void Storage::
@@ -2376,20 +2401,16 @@ smoothSpline(int aOrder,double aCutoffFrequency)
     }
 
     // LOOP OVER COLUMNS
-    double *times=NULL;
-    int nc = getSmallestNumberOfStates();
-    double *signal=NULL;
-    Array<double> filt(0.0,size);
-    getTimeColumn(times,0);
-    for(int i=0;i<nc;i++) {
-        getDataColumn(i,signal);
-        Signal::SmoothSpline(aOrder,dtmin,aCutoffFrequency,size,times,signal,&filt[0]);
-        setDataColumn(i,filt);
+    ColumnData columns;
+    gatherColumns(columns);
+    std::vector<double> signal(size);
+    for(int i=0;i<columns.numColumns;i++) {
+        double *column = columns.updColumn(i);
+        std::copy(column,column+size,signal.begin());
+        Signal::SmoothSpline(aOrder,dtmin,aCutoffFrequency,size,
+                columns.times.data(),signal.data(),column);
     }
-
-    // CLEANUP
-    delete[] times;
-    delete[] signal;
+    scatterColumns(columns);
 }
 
 void Storage::
@@ -2416,17 +2437,15 @@ lowpassIIR(double aCutoffFrequency)
     }
 
     // LOOP OVER COLUMNS
-    int nc = getSmallestNumberOfStates();
-    double *signal=NULL;
-    Array<double> filt(0.0,size);
-    for(int i=0;i<nc;i++) {
-        getDataColumn(i,signal);
-        Signal::LowpassIIR(dtmin,aCutoffFrequency,size,signal,&filt[0]);
-        setDataColumn(i,filt);
+    ColumnData columns;
+    gatherColumns(columns);
+    std::vector<double> signal(size);
+    for(int i=0;i<columns.numColumns;i++) {
+        double *column = columns.updColumn(i);
+        std::copy(column,column+size,signal.begin());
+        Signal::LowpassIIR(dtmin,aCutoffFrequency,size,signal.data(),column);
     }
-
-    // CLEANUP
-    delete[] signal;
+    scatterColumns(columns);
 }
 
 void Storage::
@@ -2453,17 +2472,83 @@ lowpassFIR(int aOrder,double aCutoffFrequency)
     }
 
     // LOOP OVER COLUMNS
-    int nc = getSmallestNumberOfStates();
-    double *signal=NULL;
-    Array<double> filt(0.0,size);
-    for(int i=0;i<nc;i++) {
-        getDataColumn(i,signal);
-        Signal::LowpassFIR(aOrder,dtmin,aCutoffFrequency,size,signal,&filt[0]);
-        setDataColumn(i,filt);
+    ColumnData columns;
+    gatherColumns(columns);
+    std::vector<double> signal(size);
+    for(int i=0;i<columns.numColumns;i++) {
+        double *column = columns.updColumn(i);
+        std::copy(column,column+size,signal.begin());
+        Signal::LowpassFIR(aOrder,dtmin,aCutoffFrequency,size,signal.data(),column);
     }
+    scatterColumns(columns);
+}
 
-    // CLEANUP
-    delete[] signal;
+
+//_____________________________________________________________________________
+/**
+ * Copy the time column and the first aN data columns into the column-major
+ * block rColumns, visiting each row once. If aN is negative, or exceeds the
+ * smallest number of states in a row, all columns shared by every row are
+ * copied.
+ */
+void Storage::
+gatherColumns(ColumnData& rColumns, int aN) const
+{
+    const int nr = _storage.getSize();
+    int nc = getSmallestNumberOfStates();
+    if(aN>=0 && aN<nc) nc = aN;
+
+    rColumns.numRows = nr;
+    rColumns.numColumns = nc;
+    rColumns.times.resize(nr);
+    rColumns.values.resize((std::size_t)nr*nc);
+    for(int i=0;i<nr;i++) {
+        const StateVector& vec = _storage[i];
+        rColumns.times[i] = vec.getTime();
+        const double *row = vec.getData().get();
+        double *value = rColumns.values.data() + i;
+        for(int j=0;j<nc;j++,value+=nr) *value = row[j];
+    }
+}
+//_____________________________________________________________________________
+/**
+ * Copy the columns in aColumns back into the rows they were gathered from,
+ * visiting each row once. The number of rows must not have changed.
+ */
+void Storage::
+scatterColumns(const ColumnData& aColumns)
+{
+    const int nr = aColumns.numRows;
+    const int nc = aColumns.numColumns;
+    OPENSIM_THROW_IF(nr != _storage.getSize(), Exception,
+            "Expected {} rows, but the storage has {}.",
+            nr, _storage.getSize());
+    for(int i=0;i<nr;i++) {
+        double *row = _storage.updElt(i).getData().get();
+        const double *value = aColumns.values.data() + i;
+        for(int j=0;j<nc;j++,value+=nr) row[j] = *value;
+    }
+}
+//_____________________________________________________________________________
+/**
+ * Replace all stored rows with rows built from the columns in aColumns.
+ */
+void Storage::
+setRowsFromColumns(const ColumnData& aColumns)
+{
+    const int nr = aColumns.numRows;
+    const int nc = aColumns.numColumns;
+    _storage.setSize(0);
+    _storage.ensureCapacity(nr);
+    StateVector vec;
+    vec.getData().setSize(nc);
+    for(int i=0;i<nr;i++) {
+        vec.setTime(aColumns.times[i]);
+        double *row = vec.getData().get();
+        const double *value = aColumns.values.data() + i;
+        for(int j=0;j<nc;j++,value+=nr) row[j] = *value;
+        _storage.append(vec);
+    }
 }
 
 
@@ -2634,34 +2719,77 @@ resampleLinear(double aDT)
 /**
  * interpolateAt passed in list of time values. Tries to check if there is a data
  * row at the specified times to avoid introducing duplicates.
+ *
+ * The new rows are linearly interpolated from the existing rows and then
+ * merged into the storage in a single pass, instead of inserting them one at
+ * a time (which shifts, and copies, all subsequent rows on every insertion).
  */
 void Storage::interpolateAt(const Array<double> &targetTimes)
 {
-    for(int i=0; i<targetTimes.getSize();i++){
-        double t = targetTimes[i];
-        // get index for t
-        int tIndex = findIndex(t);
+    const int nr = _storage.getSize();
+    if (nr==0) return;
+    std::vector<double> times(nr);
+    for(int i=0;i<nr;i++) times[i] = _storage[i].getTime();
+
+    // INTERPOLATE THE NEW ROWS
+    std::vector<StateVector> newRows;
+    newRows.reserve(targetTimes.getSize());
+    for(int k=0; k<targetTimes.getSize();k++){
+        double t = targetTimes[k];
+        // index of the last row at or before t (0 if t precedes all rows)
+        int tIndex = (int)(std::upper_bound(times.begin(),times.end(),t) -
+                times.begin()) - 1;
+        if (tIndex<0) tIndex = 0;
         // If within small number from t then pass
-        double actualTime=0.0;
-        if (tIndex < getSize()-1){
-            getTime(tIndex+1, actualTime);
-            if (fabs(actualTime - t)<1e-6)
-                    continue;
-        }
+        if (tIndex < nr-1 && fabs(times[tIndex+1] - t)<1e-6) continue;
         // or could be the following one too
-        getTime(tIndex, actualTime);
-        if (fabs(actualTime - t)<1e-6)
-                continue;
-        // create a StateVector and add it
-        double *y=NULL;
-        int ny=0;
-        StateVector vec;
-        // INTERPOLATE THE STATES
-        ny = getDataAtTime(t,ny,&y);
-        vec.setStates(t, SimTK::Vector_<double>(ny, y));
+        if (fabs(times[tIndex] - t)<1e-6) continue;
+
+        int i1 = tIndex, i2 = tIndex+1;
+        if (i2==nr) {
+            i1--;  if(i1<0) i1=0;
+            i2--;
+        }
+        const StateVector& v1 = _storage[i1];
+        const StateVector& v2 = _storage[i2];
+        const int ns = std::min(v1.getSize(), v2.getSize());
+        const double den = times[i2] - times[i1];
+        const double pct = den<SimTK::Eps ? 0.0 : (t - times[i1])/den;
+        StateVector vec(t);
+        Array<double>& y = vec.getData();
+        y.setSize(ns);
+        for(int j=0;j<ns;j++) {
+            const double y1 = v1.getData()[j];
+            y[j] = pct==0.0 ? y1 : y1 + pct*(v2.getData()[j] - y1);
+        }
+        newRows.push_back(vec);
+    }
+    if (newRows.empty()) return;
+
+    // DROP NEW ROWS THAT DUPLICATE OTHER NEW ROWS
+    std::stable_sort(newRows.begin(), newRows.end(),
+            [](const StateVector& a, const StateVector& b) {
+                return a.getTime() < b.getTime();
+            });
+    std::vector<StateVector> uniqueRows;
+    uniqueRows.reserve(newRows.size());
+    for (const auto& vec : newRows) {
+        if (!uniqueRows.empty() &&
+                fabs(vec.getTime() - uniqueRows.back().getTime())<1e-6)
+            continue;
+        uniqueRows.push_back(vec);
+    }
 
-        _storage.insert(tIndex+1, vec);
+    // MERGE
+    Array<StateVector> merged;
+    merged.ensureCapacity(nr + (int)uniqueRows.size());
+    int i = 0;
+    for (const auto& vec : uniqueRows) {
+        while (i<nr && times[i]<=vec.getTime()) merged.append(_storage[i++]);
+        merged.append(vec);
     }
+    while (i<nr) merged.append(_storage[i++]);
+    _storage = merged;
 }
 //=============================================================================
 // IO
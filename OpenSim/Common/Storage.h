@@ -32,6 +32,8 @@
 #include "StorageInterface.h"
 #include "TimeSeriesTable.h"
 
+#include <vector>
+
 const int Storage_DEFAULT_CAPACITY = 256;
 //=============================================================================
 //=============================================================================
@@ -368,6 +370,28 @@ public:
         const std::string &aDir,double aDT,const std::string &aExtension);
     void interpolateAt(const Array<double> &targetTimes);
 private:
+    /** Column-major copy of the data: the time column and the first
+    numColumns data columns, each stored contiguously. Rows are still the
+    primary storage (getStateVector() exposes them); the column operations
+    (filtering, padding, interpolation) gather into this block once, operate
+    on whole columns, and write the rows back once. */
+    struct ColumnData {
+        int numRows = 0;
+        int numColumns = 0;
+        std::vector<double> times;
+        std::vector<double> values;
+        double* updColumn(int aIndex)
+        {   return values.data() + (std::size_t)aIndex*numRows; }
+        const double* getColumn(int aIndex) const
+        {   return values.data() + (std::size_t)aIndex*numRows; }
+    };
+    /** Gather the first aN columns (all columns shared by every row if aN is
+    negative) in a single pass over the rows. */
+    void gatherColumns(ColumnData& rColumns, int aN=-1) const;
+    /** Write the columns back into the existing rows in a single pass. */
+    void scatterColumns(const ColumnData& aColumns);
+    /** Replace all rows with rows built from aColumns. */
+    void setRowsFromColumns(const ColumnData& aColumns);
     int writeHeader(FILE *rFP,double aDT=-1) const;
     int writeSIMMHeader(FILE *rFP,double aDT=-1, const char*aComment=0) const;
     int writeDescription(FILE *rFP) const;
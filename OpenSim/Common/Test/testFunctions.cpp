@@ -24,11 +24,21 @@
 #include "ComponentsForTesting.h"
 
 #include <OpenSim/Common/CommonUtilities.h>
+#include <OpenSim/Common/Constant.h>
+#include <OpenSim/Common/GCVSpline.h>
+#include <OpenSim/Common/LinearFunction.h>
+#include <OpenSim/Common/MultiplierFunction.h>
 #include <OpenSim/Common/MultivariatePolynomialFunction.h>
+#include <OpenSim/Common/PiecewiseConstantFunction.h>
+#include <OpenSim/Common/PiecewiseLinearFunction.h>
 #include <OpenSim/Common/Reporter.h>
 #include <OpenSim/Common/SignalGenerator.h>
+#include <OpenSim/Common/SimmSpline.h>
+#include <OpenSim/Common/SmoothSegmentedFunctionFactory.h>
 #include <OpenSim/Common/Sine.h>
 
+#include <atomic>
+
 #define CATCH_CONFIG_MAIN
 #include <OpenSim/Auxiliary/catch.hpp>
 #include <OpenSim/Common/PolynomialFunction.h>
@@ -153,6 +163,170 @@ TEST_CASE("MultivariatePolynomialFunction") {
     }
 }
 
+TEST_CASE("SimmSpline createSimTKFunction()") {
+    // The specialized SimTK::Function must give exactly the same values and
+    // derivatives as the OpenSim::Function, including at the knots and when
+    // extrapolating.
+    const double x[] = {-2.0944, -1.74533, -1.39626, -1.0472, -0.698132,
+            -0.349066, -0.174533, 0.197344, 0.337395, 0.490178, 1.52146,
+            2.0944};
+    const double y[] = {-0.0032, 0.00179, 0.00411, 0.0041, 0.00212, -0.001,
+            -0.0031, -0.005227, -0.005435, -0.005574, -0.005435, -0.00525};
+    const int n = sizeof(x) / sizeof(x[0]);
+    SimmSpline spline(n, x, y);
+    MultiplierFunction multiplier(spline.clone(), 0.75);
+
+    std::unique_ptr<SimTK::Function> simtkSpline(
+            spline.createSimTKFunction());
+    std::unique_ptr<SimTK::Function> simtkMultiplier(
+            multiplier.createSimTKFunction());
+    CHECK(simtkSpline->getArgumentSize() == 1);
+    CHECK(simtkSpline->getMaxDerivativeOrder() == 2);
+    CHECK(simtkMultiplier->getMaxDerivativeOrder() == 2);
+
+    std::vector<double> inputs(x, x + n);
+    for (double value = -2.5; value <= 2.5; value += 0.01) {
+        inputs.push_back(value);
+    }
+    const std::vector<int> d1{0};
+    const std::vector<int> d2{0, 0};
+    const SimTK::Array_<int> d1Array(d1);
+    const SimTK::Array_<int> d2Array(d2);
+    for (const double& value : inputs) {
+        const SimTK::Vector arg(1, value);
+        CHECK(simtkSpline->calcValue(arg) == spline.calcValue(arg));
+        CHECK(simtkSpline->calcDerivative(d1Array, arg) ==
+                spline.calcDerivative(d1, arg));
+        CHECK(simtkSpline->calcDerivative(d2Array, arg) ==
+                spline.calcDerivative(d2, arg));
+        CHECK(simtkMultiplier->calcValue(arg) == multiplier.calcValue(arg));
+        CHECK(simtkMultiplier->calcDerivative(d1Array, arg) ==
+                multiplier.calcDerivative(d1, arg));
+        CHECK(simtkMultiplier->calcDerivative(d2Array, arg) ==
+                multiplier.calcDerivative(d2, arg));
+    }
+
+    CHECK_THROWS(simtkSpline->calcDerivative(
+            SimTK::Array_<int>(3, 0), SimTK::Vector(1, 0.0)));
+}
+
+TEST_CASE("calcValueAndDerivatives()") {
+    // The scalar interface must agree with calcValue() and calcDerivative(),
+    // including at the knots and when extrapolating.
+    const double x[] = {-1.0, -0.4, 0.1, 0.5, 1.2, 2.0};
+    const double y[] = {0.3, -0.2, 0.05, 0.6, 0.4, 0.9};
+    const int n = sizeof(x) / sizeof(x[0]);
+    std::vector<double> inputs(x, x + n);
+    for (double value = -1.5; value <= 2.5; value += 0.0125) {
+        inputs.push_back(value);
+    }
+
+    const std::vector<int> d1{0};
+    const std::vector<int> d2{0, 0};
+    auto check = [&](const OpenSim::Function& f, int maxDerivOrder,
+                         double tol) {
+        CAPTURE(f.getConcreteClassName());
+        for (const double& value : inputs) {
+            CAPTURE(value);
+            const SimTK::Vector arg(1, value);
+            for (int order = 0; order <= maxDerivOrder; ++order) {
+                const SimTK::Vec3 result =
+                        f.calcValueAndDerivatives(value, order);
+                CHECK(result[0] == Approx(f.calcValue(arg)).margin(tol));
+                if (order >= 1) {
+                    CHECK(result[1] ==
+                            Approx(f.calcDerivative(d1, arg)).margin(tol));
+                }
+                if (order >= 2) {
+                    CHECK(result[2] ==
+                            Approx(f.calcDerivative(d2, arg)).margin(tol));
+                }
+            }
+        }
+    };
+
+    check(Constant(0.7), 2, 0);
+    check(LinearFunction(-1.3, 0.2), 2, 0);
+    check(PolynomialFunction(createVector({0.5, -1.0, 2.0, 0.25})), 2, 1e-12);
+    check(Sine(1.5, 3.1, 0.3, 0.12345), 2, 0);
+    check(SimmSpline(n, x, y), 2, 0);
+    check(PiecewiseLinearFunction(n, x, y), 2, 0);
+    check(PiecewiseConstantFunction(n, x, y), 2, 0);
+    check(GCVSpline(5, n, x, y), 2, 1e-12);
+    check(MultiplierFunction(new SimmSpline(n, x, y), -2.5), 2, 0);
+
+    // The default implementation.
+    check(MultivariatePolynomialFunction(createVector({0.3, 1.2, -0.8}), 1, 2),
+            1, 0);
+
+    // Only functions that override calcValueAndDerivatives() report it as
+    // fast, so that FunctionAdapter uses it only for those.
+    CHECK(SimmSpline(n, x, y).hasFastValueAndDerivatives());
+    CHECK(MultiplierFunction(new SimmSpline(n, x, y), -2.5)
+                    .hasFastValueAndDerivatives());
+    CHECK_FALSE(MultivariatePolynomialFunction(
+            createVector({0.3, 1.2, -0.8}), 1, 2)
+                    .hasFastValueAndDerivatives());
+    CHECK_FALSE(MultiplierFunction(new MultivariatePolynomialFunction(
+            createVector({0.3, 1.2, -0.8}), 1, 2), -2.5)
+                    .hasFastValueAndDerivatives());
+
+    SECTION("SmoothSegmentedFunction") {
+        std::unique_ptr<SmoothSegmentedFunction> curve(
+                SmoothSegmentedFunctionFactory::createFiberForceLengthCurve(
+                        0.0, 0.7, 0.2, 2.0 / (0.7 - 0.0), 0.75, false,
+                        "test"));
+        for (double value = 0.5; value <= 2.2; value += 0.01) {
+            CAPTURE(value);
+            const SimTK::Vec3 result = curve->calcValueAndDerivatives(value);
+            CHECK(result[0] == curve->calcValue(value));
+            CHECK(result[1] == curve->calcDerivative(value, 1));
+            CHECK(result[2] == curve->calcDerivative(value, 2));
+        }
+    }
+}
+
+TEST_CASE("parallelFor() and ThreadPool") {
+    const int count = 1000;
+    std::vector<int> results(count, 0);
+    auto square = [&](int i) { results[i] = i * i; };
+    auto checkResults = [&]() {
+        for (int i = 0; i < count; ++i) {
+            CAPTURE(i);
+            REQUIRE(results[i] == i * i);
+        }
+        std::fill(results.begin(), results.end(), 0);
+    };
+    const int numThreads = GENERATE(0, 1, 4);
+    CAPTURE(numThreads);
+
+    parallelFor(count, square, numThreads);
+    checkResults();
+
+    // The same threads run all loops, including loops with fewer tasks than
+    // threads.
+    ThreadPool pool(numThreads);
+    CHECK(pool.getNumThreads() >= 1);
+    for (int iloop = 0; iloop < 3; ++iloop) {
+        pool.parallelFor(count, square);
+        checkResults();
+    }
+    pool.parallelFor(2, square);
+    CHECK(results[1] == 1);
+
+    // All tasks run even if some throw.
+    std::atomic<int> numRun(0);
+    auto throwOnOdd = [&](int i) {
+        ++numRun;
+        if (i % 2) OPENSIM_THROW(Exception, "Odd task.");
+    };
+    CHECK_THROWS_AS(parallelFor(100, throwOnOdd, numThreads), Exception);
+    CHECK(numRun == 100);
+    numRun = 0;
+    CHECK_THROWS_AS(pool.parallelFor(100, throwOnOdd), Exception);
+    CHECK(numRun == 100);
+}
+
 TEST_CASE("solveBisection()") {
 
     auto calcResidual = [](const SimTK::Real& x) { return x - 3.78; };
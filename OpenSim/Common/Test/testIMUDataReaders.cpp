@@ -0,0 +1,301 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  testIMUDataReaders.cpp                    *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2022 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OpenSim/Common/APDMDataReader.h"
+#include "OpenSim/Common/FileAdapter.h"
+#include "OpenSim/Common/Logger.h"
+#include "OpenSim/Common/Stopwatch.h"
+#include "OpenSim/Common/XsensDataReader.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/catch.hpp>
+
+using namespace OpenSim;
+
+namespace {
+const int NumSensors = 17;
+
+std::string sensorName(int isensor) {
+    return "sensor" + std::to_string(isensor);
+}
+
+// Write one row of numbers with 6 decimals, as the IMU software does.
+void writeNumbers(std::ostream& stream, const double* values, int count,
+        char delimiter) {
+    char buffer[32];
+    for (int i = 0; i < count; ++i) {
+        std::snprintf(buffer, sizeof(buffer), "%.6f", values[i]);
+        stream << delimiter << buffer;
+    }
+}
+
+// The 18 numbers of one sensor at one time: acceleration, angular velocity,
+// magnetic field, and the rotation matrix (column major) or quaternion.
+void generateSample(SimTK::Random::Uniform& random, double* values,
+        bool quaternion) {
+    for (int i = 0; i < 9; ++i) values[i] = 20 * random.getValue() - 10;
+    const SimTK::Rotation R(
+            SimTK::Pi * random.getValue(), SimTK::UnitVec3(random.getValue(),
+                    random.getValue() - 0.5, 0.5 - random.getValue()));
+    if (quaternion) {
+        const SimTK::Quaternion q = R.convertRotationToQuaternion();
+        for (int i = 0; i < 4; ++i) values[9 + i] = q[i];
+    } else {
+        for (int col = 0; col < 3; ++col)
+            for (int row = 0; row < 3; ++row)
+                values[9 + 3 * col + row] = R[row][col];
+    }
+}
+
+// Write one Xsens file per sensor with the given number of rows (the first
+// sensor's file has one row fewer, to test that the tables end with the
+// shortest file).
+XsensDataReaderSettings writeXsensFiles(const std::string& prefix,
+        int numRows) {
+    XsensDataReaderSettings settings;
+    settings.set_trial_prefix(prefix);
+    SimTK::Random::Uniform random(0, 1);
+    random.setSeed(0);
+    double values[18];
+    for (int isensor = 0; isensor < NumSensors; ++isensor) {
+        settings.append_ExperimentalSensors(
+                ExperimentalSensor(sensorName(isensor), sensorName(isensor)));
+        std::ofstream file(prefix + sensorName(isensor) + ".txt");
+        file << "// Start Time: Unknown\n"
+                "// Update Rate: 100.0Hz\n"
+                "// Filter Profile: human (46.1)\n"
+                "PacketCounter\tSampleTimeFine\tAcc_X\tAcc_Y\tAcc_Z\t"
+                "Gyr_X\tGyr_Y\tGyr_Z\tMag_X\tMag_Y\tMag_Z\t"
+                "Mat[1][1]\tMat[2][1]\tMat[3][1]\tMat[1][2]\tMat[2][2]\t"
+                "Mat[3][2]\tMat[1][3]\tMat[2][3]\tMat[3][3]\n";
+        const int numFileRows = isensor == 0 ? numRows - 1 : numRows;
+        for (int irow = 0; irow < numFileRows; ++irow) {
+            generateSample(random, values, false);
+            file << irow << '\t';
+            writeNumbers(file, values, 18, '\t');
+            file << '\n';
+        }
+    }
+    return settings;
+}
+
+// Write an APDM file (in the format with a Sample Rate header) with
+// temperature and pressure columns after the orientation of each sensor.
+APDMDataReaderSettings writeAPDMFile(const std::string& fileName,
+        int numRows) {
+    APDMDataReaderSettings settings;
+    std::ofstream file(fileName);
+    file << "Test Name:,Synthetic\nSample Rate:,128,Hz\nTime";
+    for (int isensor = 0; isensor < NumSensors; ++isensor) {
+        settings.append_ExperimentalSensors(
+                ExperimentalSensor(sensorName(isensor), sensorName(isensor)));
+        for (const auto* labels : {&APDMDataReader::acceleration_labels,
+                     &APDMDataReader::angular_velocity_labels,
+                     &APDMDataReader::magnetic_heading_labels,
+                     &APDMDataReader::orientation_labels}) {
+            for (const auto& label : *labels)
+                file << ',' << sensorName(isensor) << label;
+        }
+        file << ',' << sensorName(isensor) << "/Temperature/Scalar,"
+             << sensorName(isensor) << "/Pressure/Scalar";
+    }
+    file << "\ns\n";
+    SimTK::Random::Uniform random(0, 1);
+    random.setSeed(0);
+    double values[18];
+    const double extra[2] = {22.75, 100.54};
+    for (int irow = 0; irow < numRows; ++irow) {
+        file << irow / 128.0;
+        for (int isensor = 0; isensor < NumSensors; ++isensor) {
+            generateSample(random, values, true);
+            writeNumbers(file, values, 13, ',');
+            writeNumbers(file, extra, 2, ',');
+        }
+        file << '\n';
+    }
+    return settings;
+}
+
+// Read the Xsens files one row at a time with FileAdapter::getNextLine() and
+// std::stod(), as XsensDataReader did before parsing the files in parallel.
+// Returns the orientations and accelerations.
+void readXsensFilesWithStod(const XsensDataReaderSettings& settings,
+        SimTK::Matrix_<SimTK::Quaternion>& rotations,
+        SimTK::Matrix_<SimTK::Vec3>& accelerations) {
+    std::vector<std::unique_ptr<std::ifstream>> streams;
+    for (int isensor = 0; isensor < NumSensors; ++isensor) {
+        streams.emplace_back(new std::ifstream(settings.get_trial_prefix() +
+                settings.get_ExperimentalSensors(isensor).getName() + ".txt"));
+        std::string line;
+        do {
+            std::getline(*streams.back(), line);
+        } while (line.substr(0, 2) == "//");
+    }
+    std::vector<SimTK::RowVector_<SimTK::Quaternion>> rotationRows;
+    std::vector<SimTK::RowVector_<SimTK::Vec3>> accelerationRows;
+    while (true) {
+        SimTK::RowVector_<SimTK::Quaternion> rotationRow(NumSensors);
+        SimTK::RowVector_<SimTK::Vec3> accelerationRow(NumSensors);
+        for (int isensor = 0; isensor < NumSensors; ++isensor) {
+            const auto tokens =
+                    FileAdapter::getNextLine(*streams[isensor], "\t\r");
+            if (tokens.empty()) {
+                rotations.resize((int)rotationRows.size(), NumSensors);
+                accelerations.resize((int)rotationRows.size(), NumSensors);
+                for (int irow = 0; irow < (int)rotationRows.size(); ++irow) {
+                    rotations[irow] = rotationRows[irow];
+                    accelerations[irow] = accelerationRows[irow];
+                }
+                return;
+            }
+            accelerationRow[isensor] = SimTK::Vec3(std::stod(tokens[2]),
+                    std::stod(tokens[3]), std::stod(tokens[4]));
+            SimTK::Mat33 matrix;
+            for (int col = 0; col < 3; ++col)
+                for (int row = 0; row < 3; ++row)
+                    matrix[row][col] = std::stod(tokens[11 + 3 * col + row]);
+            rotationRow[isensor] =
+                    SimTK::Rotation(matrix).convertRotationToQuaternion();
+        }
+        rotationRows.push_back(rotationRow);
+        accelerationRows.push_back(accelerationRow);
+    }
+}
+} // anonymous namespace
+
+TEST_CASE("XsensDataReader matches parsing each token with std::stod") {
+    const int numRows = 500;
+    const auto settings = writeXsensFiles("parse_xsens_", numRows);
+    const auto tables = XsensDataReader(settings).read("./");
+    const auto& orientations = IMUDataReader::getOrientationsTable(tables);
+    const auto& accelerations =
+            IMUDataReader::getLinearAccelerationsTable(tables);
+    REQUIRE(orientations.getNumRows() == numRows - 1);
+    REQUIRE(orientations.getNumColumns() == NumSensors);
+    CHECK(IMUDataReader::getAngularVelocityTable(tables).getNumRows() ==
+            numRows - 1);
+    CHECK(IMUDataReader::getMagneticHeadingTable(tables).getNumRows() ==
+            numRows - 1);
+    CHECK(orientations.getIndependentColumn()[1] == Approx(0.01));
+
+    SimTK::Matrix_<SimTK::Quaternion> expectedRotations;
+    SimTK::Matrix_<SimTK::Vec3> expectedAccelerations;
+    readXsensFilesWithStod(settings, expectedRotations, expectedAccelerations);
+    REQUIRE(expectedRotations.nrow() == numRows - 1);
+    for (int irow = 0; irow < numRows - 1; ++irow) {
+        for (int isensor = 0; isensor < NumSensors; ++isensor) {
+            CHECK(orientations.getMatrix()(irow, isensor) ==
+                    expectedRotations(irow, isensor));
+            CHECK(accelerations.getMatrix()(irow, isensor) ==
+                    expectedAccelerations(irow, isensor));
+        }
+    }
+}
+
+TEST_CASE("XsensDataReader reports a malformed row") {
+    const auto settings = writeXsensFiles("malformed_xsens_", 20);
+    {
+        std::ofstream file("malformed_xsens_" + sensorName(3) + ".txt",
+                std::ios::app);
+        file << "20\t\tnot_a_number\n";
+    }
+    // The malformed row is after the end of the shortest file.
+    CHECK(XsensDataReader(settings).read("./").at(
+                  IMUDataReader::Orientations)->getNumRows() == 19);
+    {
+        std::ofstream file("malformed_xsens_" + sensorName(0) + ".txt",
+                std::ios::app);
+        file << "19\t\tnot_a_number\n";
+    }
+    CHECK_THROWS_AS(XsensDataReader(settings).read("./"), Exception);
+}
+
+TEST_CASE("APDMDataReader reads a wide file with many sensors") {
+    // More rows than the batch size, to read several batches.
+    const int numRows = 5000;
+    const auto settings = writeAPDMFile("parse_apdm.csv", numRows);
+    const auto tables = APDMDataReader(settings).read("parse_apdm.csv");
+    const auto& orientations = IMUDataReader::getOrientationsTable(tables);
+    REQUIRE(orientations.getNumRows() == numRows);
+    REQUIRE(orientations.getNumColumns() == NumSensors);
+
+    // Compare the last row with the tokens of the last line of the file.
+    std::ifstream file("parse_apdm.csv");
+    std::string line, lastLine;
+    while (std::getline(file, line)) {
+        if (!line.empty()) lastLine = line;
+    }
+    const auto tokens = FileAdapter::tokenize(lastLine, ",");
+    const auto& accelerations =
+            IMUDataReader::getLinearAccelerationsTable(tables);
+    for (int isensor = 0; isensor < NumSensors; ++isensor) {
+        const int start = 1 + 15 * isensor;
+        CHECK(accelerations.getMatrix()(numRows - 1, isensor) ==
+                SimTK::Vec3(std::stod(tokens[start]),
+                        std::stod(tokens[start + 1]),
+                        std::stod(tokens[start + 2])));
+        CHECK(orientations.getMatrix()(numRows - 1, isensor) ==
+                SimTK::Quaternion(std::stod(tokens[start + 9]),
+                        std::stod(tokens[start + 10]),
+                        std::stod(tokens[start + 11]),
+                        std::stod(tokens[start + 12])));
+    }
+}
+
+TEST_CASE("IMU data reader benchmark", "[.benchmark]") {
+    // Set OPENSIM_IMU_BENCHMARK_MINUTES to time longer recordings (e.g., 60).
+    double minutes = 2;
+    if (const char* value = std::getenv("OPENSIM_IMU_BENCHMARK_MINUTES"))
+        minutes = std::stod(value);
+
+    const int numXsensRows = (int)(minutes * 60 * 100);
+    const auto xsensSettings = writeXsensFiles("benchmark_xsens_",
+            numXsensRows);
+    Stopwatch watch;
+    const auto xsensTables = XsensDataReader(xsensSettings).read("./");
+    const double xsensTime = watch.getElapsedTime();
+    watch.reset();
+    SimTK::Matrix_<SimTK::Quaternion> rotations;
+    SimTK::Matrix_<SimTK::Vec3> accelerations;
+    readXsensFilesWithStod(xsensSettings, rotations, accelerations);
+    const double stodTime = watch.getElapsedTime();
+    CHECK(xsensTables.at(IMUDataReader::Orientations)->getNumRows() ==
+            rotations.nrow());
+
+    const int numAPDMRows = (int)(minutes * 60 * 128);
+    const auto apdmSettings = writeAPDMFile("benchmark_apdm.csv", numAPDMRows);
+    watch.reset();
+    const auto apdmTables =
+            APDMDataReader(apdmSettings).read("benchmark_apdm.csv");
+    const double apdmTime = watch.getElapsedTime();
+    CHECK(apdmTables.at(IMUDataReader::Orientations)->getNumRows() ==
+            numAPDMRows);
+
+    log_info("{} sensors, {} minutes: XsensDataReader took {} s ({} s reading "
+             "the files one token at a time with std::stod); APDMDataReader "
+             "took {} s.",
+            NumSensors, minutes, xsensTime, stodTime, apdmTime);
+}
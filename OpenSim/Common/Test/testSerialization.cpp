@@ -32,11 +32,14 @@
 #include <OpenSim/Common/IO.h>
 #include <OpenSim/Common/Object.h>
 #include <OpenSim/Common/Set.h>
+#include <OpenSim/Common/XMLDocument.h>
 
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 #include "SimTKcommon.h"
 
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include "SerializableObject.h"
@@ -169,6 +172,28 @@ static void testPropertyOutputHelper(const SimTK::Transform& val)
     cout << propertyTransform->toString() << endl;
 }
 
+static std::string readFile(const std::string& fileName) {
+    std::ifstream file(fileName);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// Object::print() streams the XML to the file; the file must be identical to
+// the one written from the XML document built by updateXMLNode().
+static void testPrintMatchesXMLDocument(const Object& obj,
+                                        const std::string& fileName)
+{
+    obj.print(fileName);
+    XMLDocument doc;
+    SimTK::Xml::Element root = doc.getRootElement();
+    obj.updateXMLNode(root);
+    const std::string docFileName = "fromXMLDocument_" + fileName;
+    doc.print(docFileName);
+    ASSERT(readFile(fileName) == readFile(docFileName), __FILE__, __LINE__,
+           "print() differs from XMLDocument::print() for " + fileName);
+}
+
 int main()
 {
     // Test simple stringstream functionality with SimTK::writeUnformatted
@@ -302,6 +327,12 @@ int main()
         //std::cout << (*p2) << std::endl;
         Object::setSerializeAllDefaults(true);
         obj3.print("roundtripDefaults.xml");
+        testPrintMatchesXMLDocument(obj3, "streamedDefaults.xml");
+        Object::setSerializeAllDefaults(false);
+        testPrintMatchesXMLDocument(obj1, "streamedObj1.xml");
+        testPrintMatchesXMLDocument(obj1copy, "streamedObj1copy.xml");
+        testPrintMatchesXMLDocument(obj3, "streamedObj3.xml");
+        Object::setSerializeAllDefaults(true);
 
         // Now compare object properties to make sure we're not reading and writing the file as just text!
         int numProperties1 = obj1.getPropertySet().getSize();
@@ -24,6 +24,8 @@
 #include <OpenSim/Common/Storage.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 #include <OpenSim/Common/STOFileAdapter.h>
+#include <OpenSim/Common/Signal.h>
+#include <OpenSim/Common/Stopwatch.h>
 
 using namespace OpenSim;
 using namespace std;
@@ -170,6 +172,162 @@ void testStorageGetStateIndexBackwardsCompatibility() {
     // TODO: Put XML document version in Storage header.
 }
 
+void testStorageColumnOperations() {
+    // Uniformly sampled data with a few columns.
+    const int nr = 1000;
+    const int nc = 6;
+    // Use a time step that is exact in binary so that the storage is not
+    // resampled before filtering.
+    const double dt = 1.0 / 1024;
+    auto createStorage = [](int numRows, int numColumns, double deltaT) {
+        Storage sto(numRows);
+        Array<std::string> labels("", numColumns + 1);
+        labels[0] = "time";
+        for (int j = 0; j < numColumns; ++j)
+            labels[j + 1] = "c" + std::to_string(j);
+        sto.setColumnLabels(labels);
+        SimTK::Vector row(numColumns);
+        for (int i = 0; i < numRows; ++i) {
+            const double t = i * deltaT;
+            for (int j = 0; j < numColumns; ++j)
+                row[j] = std::sin((j + 1) * t) + 0.1 * std::sin(200 * t + j);
+            sto.append(t, row);
+        }
+        return sto;
+    };
+
+    // Filtering matches filtering each column separately.
+    {
+        Storage sto = createStorage(nr, nc, dt);
+        Array<double> column;
+        sto.getDataColumn(2, column);
+        std::vector<double> expected(nr);
+        Signal::LowpassIIR(dt, 6.0, nr, &column[0], expected.data());
+        sto.lowpassIIR(6.0);
+        ASSERT(sto.getSize() == nr);
+        sto.getDataColumn(2, column);
+        for (int i = 0; i < nr; ++i) ASSERT_EQUAL(expected[i], column[i], 0.0);
+    }
+
+    // Padding prepends and appends reflected data to every column.
+    {
+        Storage sto = createStorage(nr, nc, dt);
+        const int padSize = 10;
+        Array<double> original;
+        sto.getDataColumn(nc - 1, original);
+        sto.pad(padSize);
+        ASSERT(sto.getSize() == nr + 2 * padSize);
+        ASSERT_EQUAL(-padSize * dt, sto.getFirstTime(), 1e-12);
+        Array<double> padded;
+        sto.getDataColumn(nc - 1, padded);
+        for (int i = 0; i < nr; ++i)
+            ASSERT_EQUAL(original[i], padded[i + padSize], 0.0);
+        ASSERT_EQUAL(2 * original[0] - original[padSize], padded[0], 1e-12);
+    }
+
+    // Interpolating at new times inserts linearly interpolated rows in time
+    // order, skipping times that are already present.
+    {
+        Storage sto = createStorage(10, nc, 0.1);
+        Array<double> targets;
+        targets.append(0.55);
+        targets.append(0.25);
+        targets.append(0.3);      // existing row
+        targets.append(0.250000001);  // duplicate of a new row
+        targets.append(0.95);     // after the last row
+        sto.interpolateAt(targets);
+        ASSERT(sto.getSize() == 13);
+        double time;
+        sto.getTime(3, time);
+        ASSERT_EQUAL(0.25, time, 1e-12);
+        sto.getTime(7, time);
+        ASSERT_EQUAL(0.55, time, 1e-12);
+        sto.getTime(12, time);
+        ASSERT_EQUAL(0.95, time, 1e-12);
+        double before, after, middle;
+        sto.getData(6, 0, before);
+        sto.getData(8, 0, after);
+        sto.getData(7, 0, middle);
+        ASSERT_EQUAL(0.5 * (before + after), middle, 1e-12);
+    }
+
+    // Time the column operations on a large storage.
+    {
+        const int numRows = 100000;
+        const int numColumns = 20;
+        Storage sto = createStorage(numRows, numColumns, dt);
+        Stopwatch watch;
+        Array<double> column;
+        for (int j = 0; j < numColumns; ++j) sto.getDataColumn(j, column);
+        log_info("getDataColumn ({} rows, {} columns): {}", numRows,
+                numColumns, watch.getElapsedTimeFormatted());
+        watch.reset();
+        sto.lowpassIIR(6.0);
+        log_info("lowpassIIR: {}", watch.getElapsedTimeFormatted());
+        watch.reset();
+        sto.lowpassFIR(50, 6.0);
+        log_info("lowpassFIR: {}", watch.getElapsedTimeFormatted());
+        watch.reset();
+        sto.pad(numRows / 2);
+        log_info("pad: {}", watch.getElapsedTimeFormatted());
+        watch.reset();
+        std::unique_ptr<Storage> integrated(sto.integrate());
+        log_info("integrate: {}", watch.getElapsedTimeFormatted());
+        Array<double> targets;
+        for (int i = 0; i < 1000; ++i) targets.append((50 * i + 0.5) * dt);
+        watch.reset();
+        sto.interpolateAt(targets);
+        log_info("interpolateAt ({} times): {}", targets.getSize(),
+                watch.getElapsedTimeFormatted());
+        ASSERT(sto.getSize() == 2 * numRows + targets.getSize());
+    }
+}
+
+void testStorageTableConversion() {
+    const int nr = 100000;
+    const int nc = 20;
+    Storage sto(nr);
+    Array<std::string> labels("", nc + 1);
+    labels[0] = "time";
+    for (int j = 0; j < nc; ++j) labels[j + 1] = "c" + std::to_string(j);
+    sto.setColumnLabels(labels);
+    SimTK::Vector row(nc);
+    for (int i = 0; i < nr; ++i) {
+        for (int j = 0; j < nc; ++j) row[j] = i + 0.001 * j;
+        sto.append(0.01 * i, row);
+    }
+
+    Stopwatch watch;
+    TimeSeriesTable table = sto.exportToTable();
+    log_info("exportToTable ({} rows, {} columns): {}", nr, nc,
+            watch.getElapsedTimeFormatted());
+    SimTK_TEST((int)table.getNumRows() == nr);
+    SimTK_TEST((int)table.getNumColumns() == nc);
+    SimTK_TEST(table.getColumnLabel(3) == "c3");
+    SimTK_TEST(table.getTableMetaDataAsString("nRows") == std::to_string(nr));
+    SimTK_TEST_EQ(table.getIndependentColumn()[nr - 1], 0.01 * (nr - 1));
+    SimTK_TEST_EQ(table.getMatrix()(nr - 1, nc - 1), nr - 1 + 0.001 * (nc - 1));
+
+    // Reading a file into a Storage converts a TimeSeriesTable.
+    STOFileAdapter::write(table, "testStorage_conversion.sto");
+    watch.reset();
+    Storage fromFile("testStorage_conversion.sto");
+    log_info("Storage from .sto file: {}", watch.getElapsedTimeFormatted());
+    SimTK_TEST(fromFile.getSize() == nr);
+    SimTK_TEST(fromFile.getColumnLabels().getSize() == nc + 1);
+    double value;
+    fromFile.getData(nr - 1, nc - 1, value);
+    SimTK_TEST_EQ(value, nr - 1 + 0.001 * (nc - 1));
+
+    // A Storage without column labels can still be exported.
+    Storage unlabeled;
+    unlabeled.append(0.0, SimTK::Vector(3, 1.0));
+    unlabeled.append(0.1, SimTK::Vector(3, 2.0));
+    TimeSeriesTable unlabeledTable = unlabeled.exportToTable();
+    SimTK_TEST(unlabeledTable.getNumRows() == 2);
+    SimTK_TEST(unlabeledTable.getNumColumns() == 3);
+}
+
 int main() {
     SimTK_START_TEST("testStorage");
 
@@ -194,6 +352,10 @@ int main() {
         SimTK_SUBTEST(testStorageLegacy);
 
         SimTK_SUBTEST(testStorageGetStateIndexBackwardsCompatibility);
+
+        SimTK_SUBTEST(testStorageColumnOperations);
+
+        SimTK_SUBTEST(testStorageTableConversion);
     SimTK_END_TEST();
 }
 
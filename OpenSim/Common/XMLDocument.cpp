@@ -31,6 +31,7 @@
 //-----------------------------------------------------------------------------
 #include "XMLDocument.h"
 #include "Object.h"
+#include "XMLStreamWriter.h"
 #include <functional>
 
 
@@ -191,6 +192,24 @@ print(const string &aFileName)
     return true;
 }
 //_____________________________________________________________________________
+/**
+ * Write the document, with the given object as its root data element, to a
+ * stream without building the object's elements in memory.
+ */
+void XMLDocument::
+writeToStream(const Object& aObject, std::ostream& aStream)
+{
+    SimTK::Xml::Element root = getRootElement();
+    assert(root.element_begin() == root.element_end());
+    XMLStreamWriter writer(aStream, "\t");
+    writer.writeDeclaration();
+    writer.startElement(root.getElementTag());
+    for (auto att = root.attribute_begin(); att != root.attribute_end(); ++att)
+        writer.addAttribute(att->getName(), att->getValue());
+    aObject.writeToXMLStream(writer);
+    writer.endElement();
+}
+//_____________________________________________________________________________
 
 //-----------------------------------------------------------------------------
 // FORMATTER
@@ -283,6 +302,16 @@ void XMLDocument::writeDefaultObjects(SimTK::Xml::Element& elmt)
     }
 }
 
+void XMLDocument::writeDefaultObjects(XMLStreamWriter& writer) const
+{
+    if (_defaultObjects.getSize()==0) return;
+    writer.startElement("defaults");
+    for(int i=0; i < _defaultObjects.getSize(); i++){
+        _defaultObjects.get(i)->writeToXMLStream(writer);
+    }
+    writer.endElement();
+}
+
 void XMLDocument::copyDefaultObjects(const XMLDocument &aDocument){
         _defaultObjects.setSize(0);
         for (int i=0; i< aDocument._defaultObjects.getSize(); i++)
@@ -34,6 +34,8 @@
 #include "SimTKcommon/internal/Xml.h"
 #include "SimTKcommon/SmallMatrix.h"
 
+#include <iosfwd>
+
 //using namespace std;  // Ayman:per .NET 2003
 
 
@@ -55,6 +57,7 @@ namespace OpenSim {
 #endif
 
 class Object;
+class XMLStreamWriter;
 
 class OSIMCOMMON_API XMLDocument  : public SimTK::Xml::Document {
 
@@ -83,6 +86,7 @@ public:
     XMLDocument(const XMLDocument &aDocument);
     void copyDefaultObjects(const XMLDocument &aDocument);
     void writeDefaultObjects(SimTK::Xml::Element& elmt);
+    void writeDefaultObjects(XMLStreamWriter& writer) const;
     //--------------------------------------------------------------------------
     // VERSIONING /BACKWARD COMPATIBILITY SUPPORT
     //--------------------------------------------------------------------------    
@@ -166,6 +170,11 @@ public:
     //--------------------------------------------------------------------------
     /// If the filename is empty, the file is printed to cout.
     bool print(const std::string& aFileName = {});
+    /// Write this document to a stream, in the same format as print(), with
+    /// the given object as the root data element. The object's elements are
+    /// streamed (see Object::writeToXMLStream()) rather than added to this
+    /// document, so this document must not contain any data elements.
+    void writeToStream(const Object& object, std::ostream& stream);
 
 //=============================================================================
 };  // END CLASS XMLDocument
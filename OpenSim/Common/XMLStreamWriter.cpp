@@ -0,0 +1,177 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim: XMLStreamWriter.cpp                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2022 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "XMLStreamWriter.h"
+
+#include "Exception.h"
+
+#include <cstdio>
+#include <ostream>
+
+using namespace OpenSim;
+
+XMLStreamWriter::XMLStreamWriter(std::ostream& stream, std::string indent)
+        : m_stream(stream), m_indent(std::move(indent)) {}
+
+void XMLStreamWriter::writeDeclaration() {
+    OPENSIM_THROW_IF(!m_openTags.empty(), Exception,
+            "The XML declaration must precede all elements.");
+    m_stream << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n";
+}
+
+void XMLStreamWriter::startElement(const std::string& tag) {
+    beginChildNode();
+    m_stream << '<' << tag;
+    m_openTags.push_back(tag);
+    m_startTagIsOpen = true;
+}
+
+void XMLStreamWriter::addAttribute(
+        const std::string& name, const std::string& value) {
+    OPENSIM_THROW_IF(!m_startTagIsOpen, Exception,
+            "Attribute '" + name + "' must be added before the contents of "
+            "its element.");
+    // Same as SimTK::Xml: double quotes unless the value contains one.
+    const char quote = value.find('"') == std::string::npos ? '"' : '\'';
+    m_stream << ' ';
+    writeEncoded(name);
+    m_stream << '=' << quote;
+    writeEncoded(value);
+    m_stream << quote;
+}
+
+void XMLStreamWriter::endElement() {
+    OPENSIM_THROW_IF(m_openTags.empty(), Exception,
+            "There is no open element to end.");
+    if (m_startTagIsOpen) {
+        m_stream << " />";
+        m_startTagIsOpen = false;
+    } else {
+        m_stream << '\n';
+        for (int i = 0; i < getDepth() - 1; ++i) m_stream << m_indent;
+        m_stream << "</" << m_openTags.back() << '>';
+    }
+    m_openTags.pop_back();
+    // Each top-level node ends with a newline.
+    if (m_openTags.empty()) m_stream << '\n';
+}
+
+void XMLStreamWriter::writeComment(const std::string& comment) {
+    beginChildNode();
+    m_stream << "<!--" << comment << "-->";
+}
+
+void XMLStreamWriter::writeElement(const SimTK::Xml::Element& element) {
+    // Xml handles are shallow, so this refers to the same element.
+    SimTK::Xml::Element elt(element);
+
+    // An element that is empty or contains only text is written on a single
+    // line, so SimTK::Xml can serialize it for us.
+    SimTK::Xml::node_iterator it = elt.node_begin();
+    if (it == elt.node_end() ||
+            (it->getNodeType() == SimTK::Xml::TextNode &&
+                    ++it == elt.node_end())) {
+        beginChildNode();
+        SimTK::String str;
+        elt.writeToString(str, true);
+        m_stream << str;
+        return;
+    }
+
+    // Otherwise, write the element's nodes one at a time.
+    startElement(elt.getElementTag());
+    for (auto att = elt.attribute_begin(); att != elt.attribute_end(); ++att) {
+        addAttribute(att->getName(), att->getValue());
+    }
+    for (it = elt.node_begin(); it != elt.node_end(); ++it) {
+        if (it->getNodeType() == SimTK::Xml::ElementNode) {
+            writeElement(SimTK::Xml::Element::getAs(*it));
+            continue;
+        }
+        SimTK::String str;
+        it->writeToString(str, true);
+        if (it->getNodeType() == SimTK::Xml::TextNode) {
+            // Text is not placed on its own line.
+            if (m_startTagIsOpen) {
+                m_stream << '>';
+                m_startTagIsOpen = false;
+            }
+        } else {
+            beginChildNode();
+        }
+        m_stream << str;
+    }
+    endElement();
+}
+
+void XMLStreamWriter::beginChildNode() {
+    if (m_startTagIsOpen) {
+        m_stream << '>';
+        m_startTagIsOpen = false;
+    }
+    if (m_openTags.empty()) return;
+    m_stream << '\n';
+    for (int i = 0; i < getDepth(); ++i) m_stream << m_indent;
+}
+
+void XMLStreamWriter::writeEncoded(const std::string& str) {
+    // This follows the encoding of the TinyXML library used by SimTK::Xml.
+    m_buffer.clear();
+    const size_t length = str.length();
+    size_t i = 0;
+    while (i < length) {
+        const unsigned char c = (unsigned char)str[i];
+        if (c == '&' && i + 2 < length && str[i + 1] == '#' &&
+                str[i + 2] == 'x') {
+            // A hexadecimal character reference is passed through unchanged.
+            while (i < length - 1) {
+                m_buffer += str[i];
+                ++i;
+                if (str[i] == ';') break;
+            }
+        } else if (c == '&') {
+            m_buffer += "&amp;";
+            ++i;
+        } else if (c == '<') {
+            m_buffer += "&lt;";
+            ++i;
+        } else if (c == '>') {
+            m_buffer += "&gt;";
+            ++i;
+        } else if (c == '"') {
+            m_buffer += "&quot;";
+            ++i;
+        } else if (c == '\'') {
+            m_buffer += "&apos;";
+            ++i;
+        } else if (c < 32) {
+            char reference[8];
+            std::snprintf(reference, sizeof(reference), "&#x%02X;", c);
+            m_buffer += reference;
+            ++i;
+        } else {
+            m_buffer += (char)c;
+            ++i;
+        }
+    }
+    m_stream << m_buffer;
+}
@@ -0,0 +1,94 @@
+#ifndef OPENSIM_XML_STREAM_WRITER_H_
+#define OPENSIM_XML_STREAM_WRITER_H_
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim: XMLStreamWriter.h                          *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2022 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimCommonDLL.h"
+#include "SimTKcommon/internal/Xml.h"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+
+/** Write an XML document to a stream one node at a time, without building the
+SimTK::Xml document in memory first. This is used by Object::print() to
+serialize large objects (e.g., models) quickly; the output is identical to that
+of SimTK::Xml::Document::writeToFile() for a document with the same content
+and the same indent string.
+
+Elements are opened with startElement() and closed with endElement(); the
+attributes of an element must be added with addAttribute() immediately after
+startElement(). Small, already-built elements (e.g., the serialized value of
+a simple property) can be written with writeElement().
+
+@code
+XMLStreamWriter writer(stream);
+writer.writeDeclaration();
+writer.startElement("OpenSimDocument");
+writer.addAttribute("Version", "40000");
+writer.writeComment("An empty document.");
+writer.endElement();
+@endcode */
+class OSIMCOMMON_API XMLStreamWriter {
+public:
+    /** The writer does not take ownership of the stream, which must outlive
+    the writer. Each level of nesting is indented with the provided string. */
+    explicit XMLStreamWriter(std::ostream& stream, std::string indent = "\t");
+
+    /** Write the `<?xml ... ?>` declaration that starts the document. */
+    void writeDeclaration();
+    /** Open a new element as a child of the current element. */
+    void startElement(const std::string& tag);
+    /** Add an attribute to the element that was just opened. This throws an
+    exception if any nodes have already been written in that element. */
+    void addAttribute(const std::string& name, const std::string& value);
+    /** Close the most recently opened element. */
+    void endElement();
+    /** Write a comment as a child of the current element. */
+    void writeComment(const std::string& comment);
+    /** Write a complete element (with its attributes and contents) as a child
+    of the current element. */
+    void writeElement(const SimTK::Xml::Element& element);
+
+    /** The number of elements that have been opened but not yet closed. */
+    int getDepth() const { return (int)m_openTags.size(); }
+
+private:
+    // Close the start tag of the current element (if it is still open) and
+    // begin a new line at the current depth for the next child node.
+    void beginChildNode();
+    // Write the string with the characters that are special in XML replaced
+    // by entities, as SimTK::Xml does.
+    void writeEncoded(const std::string& str);
+
+    std::ostream& m_stream;
+    std::string m_indent;
+    std::vector<std::string> m_openTags;
+    bool m_startTagIsOpen = false;
+    std::string m_buffer;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_XML_STREAM_WRITER_H_
@@ -1,5 +1,8 @@
+#include <algorithm>
+#include <exception>
 #include <fstream>
 #include "Simbody.h"
+#include "CommonUtilities.h"
 #include "Exception.h"
 #include "FileAdapter.h"
 #include "TimeSeriesTable.h"
@@ -25,15 +28,6 @@ XsensDataReader::extendRead(const std::string& folderName) const {
     int rotationsIndex = -1;
 
     int n_imus = _settings.getProperty_ExperimentalSensors().size();
-    int last_size = 1024;
-    // Will read data into pre-allocated Matrices in-memory rather than appendRow
-    // on the fly to avoid the overhead of 
-    SimTK::Matrix_<SimTK::Quaternion> rotationsData{ last_size, n_imus };
-    SimTK::Matrix_<SimTK::Vec3> linearAccelerationData{ last_size, n_imus };
-    SimTK::Matrix_<SimTK::Vec3> magneticHeadingData{ last_size, n_imus };
-    SimTK::Matrix_<SimTK::Vec3> angularVelocityData{ last_size, n_imus };
-    std::vector<double> times;
-    times.resize(last_size);
     
     std::string prefix = _settings.get_trial_prefix();
     std::map<std::string, std::string> headersKeyValuePairs;
@@ -93,91 +87,124 @@ XsensDataReader::extendRead(const std::string& folderName) const {
     // If no Orientation data is available we'll abort completely
     OPENSIM_THROW_IF((rotationsIndex == -1), TableMissingHeader);
     
-    // For all tables, will create row, stitch values from different files then append,time and timestep
-    // are based on the first file
-    bool done = false;
-    double time = 0.0;
-    double timeIncrement = 1 / dataRate;
-    int rowNumber = 0;
-    while (!done){
-        // Make vectors one per table
-        TimeSeriesTableQuaternion::RowVector
-            orientation_row_vector{ n_imus, SimTK::Quaternion() };
-        TimeSeriesTableVec3::RowVector
-            accel_row_vector{ n_imus, SimTK::Vec3(SimTK::NaN) };
-        TimeSeriesTableVec3::RowVector
-            magneto_row_vector{ n_imus, SimTK::Vec3(SimTK::NaN) };
-        TimeSeriesTableVec3::RowVector
-            gyro_row_vector{ n_imus, SimTK::Vec3(SimTK::NaN) };
-        // Cycle through the filles collating values
-        int imu_index = 0;
-        for (std::vector<std::ifstream*>::iterator it = imuStreams.begin();
-            it != imuStreams.end();
-            ++it, ++imu_index) {
-            std::ifstream* nextStream = *it;
-            // parse gyro info from imuStream
-            std::vector<std::string> nextRow = FileAdapter::getNextLine(*nextStream, "\t\r");
-            if (nextRow.empty()) {
-                done = true;
-                break;
-            }
-            if (foundLinearAccelerationData)
-                accel_row_vector[imu_index] = SimTK::Vec3(std::stod(nextRow[accIndex]),
-                    std::stod(nextRow[accIndex + 1]), std::stod(nextRow[accIndex + 2]));
-            if (foundMagneticHeadingData)
-                magneto_row_vector[imu_index] = SimTK::Vec3(std::stod(nextRow[magIndex]),
-                    std::stod(nextRow[magIndex + 1]), std::stod(nextRow[magIndex + 2]));
-            if (foundAngularVelocityData)
-                gyro_row_vector[imu_index] = SimTK::Vec3(std::stod(nextRow[gyroIndex]),
-                    std::stod(nextRow[gyroIndex + 1]), std::stod(nextRow[gyroIndex + 2]));
-            // Create Mat33 then convert into Quaternion
-            SimTK::Mat33 imu_matrix{ SimTK::NaN };
-            int matrix_entry_index = 0;
-            for (int mcol = 0; mcol < 3; mcol++) {
-                for (int mrow = 0; mrow < 3; mrow++) {
-                    imu_matrix[mrow][mcol] = std::stod(nextRow[rotationsIndex + matrix_entry_index]);
-                    matrix_entry_index++;
+    // Parse the data rows of each file on its own thread, converting only the
+    // columns that are used. A file ends at its first empty line. If a row
+    // cannot be parsed, the file ends there and the error is kept, to be
+    // thrown below only if that row would have been used.
+    struct FileData {
+        std::vector<SimTK::Quaternion> rotations;
+        std::vector<SimTK::Vec3> linearAccelerations;
+        std::vector<SimTK::Vec3> magneticHeadings;
+        std::vector<SimTK::Vec3> angularVelocities;
+        std::exception_ptr error;
+    };
+    std::vector<FileData> fileData(n_imus);
+    parallelFor(n_imus, [&](int imu_index) {
+        std::ifstream& nextStream = *imuStreams[imu_index];
+        FileData& data = fileData[imu_index];
+        // The number of bytes left, to estimate the number of rows from the
+        // length of the first row and avoid regrowing the vectors.
+        const auto dataStart = nextStream.tellg();
+        nextStream.seekg(0, std::ios::end);
+        const auto numBytes = nextStream.tellg() - dataStart;
+        nextStream.seekg(dataStart);
+
+        std::string line;
+        FieldOffsets fields;
+        while (getNextLineFields(nextStream, "\t\r", line, fields)) {
+            try {
+                SimTK::Vec3 accel(SimTK::NaN), magneto(SimTK::NaN),
+                        gyro(SimTK::NaN);
+                if (foundLinearAccelerationData)
+                    accel = parseVec3Fields(line, fields, accIndex);
+                if (foundMagneticHeadingData)
+                    magneto = parseVec3Fields(line, fields, magIndex);
+                if (foundAngularVelocityData)
+                    gyro = parseVec3Fields(line, fields, gyroIndex);
+                // Create Mat33 then convert into Quaternion
+                SimTK::Mat33 imu_matrix{ SimTK::NaN };
+                int matrix_entry_index = 0;
+                for (int mcol = 0; mcol < 3; mcol++) {
+                    for (int mrow = 0; mrow < 3; mrow++) {
+                        imu_matrix[mrow][mcol] = parseField(line, fields,
+                                rotationsIndex + matrix_entry_index);
+                        matrix_entry_index++;
+                    }
                 }
+                // Convert imu_matrix to Quaternion
+                SimTK::Rotation imu_rotation{ imu_matrix };
+                data.rotations.push_back(
+                        imu_rotation.convertRotationToQuaternion());
+                if (foundLinearAccelerationData)
+                    data.linearAccelerations.push_back(accel);
+                if (foundMagneticHeadingData)
+                    data.magneticHeadings.push_back(magneto);
+                if (foundAngularVelocityData)
+                    data.angularVelocities.push_back(gyro);
+                if (data.rotations.size() == 1 && numBytes > 0) {
+                    const std::size_t estimatedNumRows =
+                            (std::size_t)numBytes / (line.size() + 1) + 1;
+                    data.rotations.reserve(estimatedNumRows);
+                    if (foundLinearAccelerationData)
+                        data.linearAccelerations.reserve(estimatedNumRows);
+                    if (foundMagneticHeadingData)
+                        data.magneticHeadings.reserve(estimatedNumRows);
+                    if (foundAngularVelocityData)
+                        data.angularVelocities.reserve(estimatedNumRows);
+                }
+            } catch (...) {
+                data.error = std::current_exception();
+                break;
             }
-            // Convert imu_matrix to Quaternion
-            SimTK::Rotation imu_rotation{ imu_matrix };
-            orientation_row_vector[imu_index] = imu_rotation.convertRotationToQuaternion();
         }
-        if (done) 
+    });
+    for (auto* nextStream : imuStreams) delete nextStream;
+
+    // The tables end with the shortest file. Rows are checked file by file,
+    // so the error (if any) is that of the first file that ends there.
+    int rowNumber = (int)fileData[0].rotations.size();
+    for (const auto& data : fileData)
+        rowNumber = std::min(rowNumber, (int)data.rotations.size());
+    for (const auto& data : fileData) {
+        if ((int)data.rotations.size() == rowNumber) {
+            if (data.error) std::rethrow_exception(data.error);
             break;
-        // append to the tables
-        times[rowNumber] = time;
-        if (foundLinearAccelerationData) 
-            linearAccelerationData[rowNumber] =  accel_row_vector;
-        if (foundMagneticHeadingData) 
-            magneticHeadingData[rowNumber] = magneto_row_vector;
-        if (foundAngularVelocityData) 
-            angularVelocityData[rowNumber] = gyro_row_vector;
-        rotationsData[rowNumber] = orientation_row_vector;
+        }
+    }
+
+    // For all tables, stitch values from different files; time and timestep
+    // are based on the data rate.
+    double time = 0.0;
+    double timeIncrement = 1 / dataRate;
+    std::vector<double> times(rowNumber);
+    for (int row = 0; row < rowNumber; ++row) {
+        times[row] = time;
         time += timeIncrement;
-        rowNumber++;
-        if (std::remainder(rowNumber, last_size) == 0) {
-            // resize all Data/Matrices, double the size  while keeping data
-            int newSize = last_size*2;
-            times.resize(newSize);
-            // Repeat for Data matrices in use
-            if (foundLinearAccelerationData) linearAccelerationData.resizeKeep(newSize, n_imus);
-            if (foundMagneticHeadingData) magneticHeadingData.resizeKeep(newSize, n_imus);
-            if (foundAngularVelocityData) angularVelocityData.resizeKeep(newSize, n_imus);
-            rotationsData.resizeKeep(newSize, n_imus);
-            last_size = newSize;
+    }
+    // Fill the matrices in use, which are allocated at their final size, or
+    // make them empty.
+    SimTK::Matrix_<SimTK::Quaternion> rotationsData{ rowNumber, n_imus };
+    SimTK::Matrix_<SimTK::Vec3> linearAccelerationData{
+            foundLinearAccelerationData ? rowNumber : 0, n_imus };
+    SimTK::Matrix_<SimTK::Vec3> magneticHeadingData{
+            foundMagneticHeadingData ? rowNumber : 0, n_imus };
+    SimTK::Matrix_<SimTK::Vec3> angularVelocityData{
+            foundAngularVelocityData ? rowNumber : 0, n_imus };
+    for (int imu_index = 0; imu_index < n_imus; ++imu_index) {
+        const FileData& data = fileData[imu_index];
+        for (int row = 0; row < rowNumber; ++row) {
+            rotationsData(row, imu_index) = data.rotations[row];
+            if (foundLinearAccelerationData)
+                linearAccelerationData(row, imu_index) =
+                        data.linearAccelerations[row];
+            if (foundMagneticHeadingData)
+                magneticHeadingData(row, imu_index) =
+                        data.magneticHeadings[row];
+            if (foundAngularVelocityData)
+                angularVelocityData(row, imu_index) =
+                        data.angularVelocities[row];
         }
     }
-    // Trim Matrices in use to actual data and move into tables
-    times.resize(rowNumber);
-    // Repeat for Data matrices in use and create Tables from them or size 0 for empty
-    linearAccelerationData.resizeKeep(foundLinearAccelerationData? rowNumber : 0,
-        n_imus);
-    magneticHeadingData.resizeKeep(foundMagneticHeadingData? rowNumber : 0,
-            n_imus);
-    angularVelocityData.resizeKeep(foundAngularVelocityData? rowNumber :0,
-        n_imus);
-    rotationsData.resizeKeep(rowNumber, n_imus);
 
     // Now create the tables from matrices
     // Create 4 tables for Rotations, LinearAccelerations, AngularVelocity, MagneticHeading
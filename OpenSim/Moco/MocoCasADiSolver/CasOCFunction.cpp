@@ -332,3 +332,94 @@ VectorDM MultibodySystemImplicit<CalcKCErrors>::eval(
 
 template class CasOC::MultibodySystemImplicit<false>;
 template class CasOC::MultibodySystemImplicit<true>;
+
+template <bool CalcKCErrors>
+casadi::Sparsity MultibodySystemImplicitBatch<CalcKCErrors>::get_sparsity_in(
+        casadi_int i) {
+    return casadi::Sparsity::dense(m_pointFunction->size1_in(i), m_batchSize);
+}
+
+template <bool CalcKCErrors>
+casadi::Sparsity MultibodySystemImplicitBatch<CalcKCErrors>::get_sparsity_out(
+        casadi_int i) {
+    // Outputs that the single-point function does not compute (e.g.,
+    // kinematic constraint errors if CalcKCErrors is false) remain 0x0.
+    if (m_pointFunction->size2_out(i) == 0) return casadi::Sparsity(0, 0);
+    return casadi::Sparsity::dense(m_pointFunction->size1_out(i), m_batchSize);
+}
+
+template <bool CalcKCErrors>
+casadi::Sparsity
+MultibodySystemImplicitBatch<CalcKCErrors>::get_jacobian_sparsity() const {
+    // Rows of the single-point Jacobian are the outputs stacked on top of each
+    // other, and columns are the inputs stacked on top of each other; same for
+    // the batch Jacobian, except that each input and output has batchSize
+    // columns (stored column-major). For each row (column) of the single-point
+    // Jacobian, compute the row (column) for the first point in the batch and
+    // the stride between consecutive points.
+    const auto createIndexMap = [this](const std::vector<casadi_int>& sizes) {
+        std::vector<std::pair<casadi_int, casadi_int>> indexMap;
+        casadi_int batchOffset = 0;
+        for (const auto& size : sizes) {
+            for (casadi_int j = 0; j < size; ++j) {
+                indexMap.emplace_back(batchOffset + j, size);
+            }
+            batchOffset += m_batchSize * size;
+        }
+        return indexMap;
+    };
+    std::vector<casadi_int> outputSizes;
+    for (casadi_int i = 0; i < m_pointFunction->n_out(); ++i) {
+        outputSizes.push_back(m_pointFunction->nnz_out(i));
+    }
+    std::vector<casadi_int> inputSizes;
+    for (casadi_int i = 0; i < m_pointFunction->n_in(); ++i) {
+        inputSizes.push_back(m_pointFunction->nnz_in(i));
+    }
+    const auto rowMap = createIndexMap(outputSizes);
+    const auto colMap = createIndexMap(inputSizes);
+
+    // Without sparsity detection, each point's block is dense.
+    const casadi::Sparsity pointSparsity =
+            m_pointFunction->has_jacobian_sparsity()
+                    ? m_pointFunction->get_jacobian_sparsity()
+                    : casadi::Sparsity::dense(m_pointFunction->nnz_out(),
+                              m_pointFunction->nnz_in());
+    std::vector<casadi_int> pointRows;
+    std::vector<casadi_int> pointCols;
+    pointSparsity.get_triplet(pointRows, pointCols);
+
+    std::vector<casadi_int> rows;
+    std::vector<casadi_int> cols;
+    rows.reserve(m_batchSize * pointRows.size());
+    cols.reserve(m_batchSize * pointCols.size());
+    for (casadi_int ipoint = 0; ipoint < m_batchSize; ++ipoint) {
+        for (int inz = 0; inz < (int)pointRows.size(); ++inz) {
+            const auto& row = rowMap[pointRows[inz]];
+            const auto& col = colMap[pointCols[inz]];
+            rows.push_back(row.first + ipoint * row.second);
+            cols.push_back(col.first + ipoint * col.second);
+        }
+    }
+    return casadi::Sparsity::triplet(nnz_out(), nnz_in(), rows, cols);
+}
+
+template <bool CalcKCErrors>
+VectorDM MultibodySystemImplicitBatch<CalcKCErrors>::eval(
+        const VectorDM& args) const {
+    Problem::ContinuousBatchInput input{args.at(0), args.at(1), args.at(2),
+            args.at(3), args.at(4), args.at(5)};
+    VectorDM out((int)n_out());
+    for (casadi_int i = 0; i < n_out(); ++i) {
+        out[i] = casadi::DM(sparsity_out(i));
+    }
+
+    Problem::MultibodySystemImplicitOutput output{out[0], out[1], out[2],
+            out[3]};
+    m_casProblem->calcMultibodySystemImplicitBatch(
+            input, CalcKCErrors, output);
+    return out;
+}
+
+template class CasOC::MultibodySystemImplicitBatch<false>;
+template class CasOC::MultibodySystemImplicitBatch<true>;
@@ -313,6 +313,48 @@ class MultibodySystemImplicit : public Function {
     VectorDM eval(const VectorDM& args) const override;
 };
 
+/// This function evaluates MultibodySystemImplicit for a block of time points
+/// per call, using a structure-of-arrays layout: column i of each input and
+/// output holds the values for the i-th point. Evaluating many points per
+/// call amortizes the overhead of each call (e.g., acquiring a
+/// MocoProblemRep) across the block. The Jacobian is block diagonal across
+/// points, with each block given by the Jacobian sparsity of the
+/// corresponding single-point function, so finite differences perturb all
+/// points in the block at once.
+template <bool CalcKCErrors>
+class MultibodySystemImplicitBatch : public Function {
+public:
+    void constructFunction(const Problem* casProblem, const std::string& name,
+            int batchSize, const Function& pointFunction,
+            const std::string& finiteDiffScheme,
+            std::shared_ptr<const std::vector<VariablesDM>>
+                    pointsForSparsityDetection) {
+        m_batchSize = batchSize;
+        m_pointFunction = &pointFunction;
+        Function::constructFunction(
+                casProblem, name, finiteDiffScheme, pointsForSparsityDetection);
+    }
+    casadi_int get_n_out() override final { return 4; }
+    std::string get_name_out(casadi_int i) override final {
+        switch (i) {
+        case 0: return "multibody_residuals";
+        case 1: return "auxiliary_derivatives";
+        case 2: return "auxiliary_residuals";
+        case 3: return "kinematic_constraint_errors";
+        default: OPENSIM_THROW(OpenSim::Exception, "Internal error.");
+        }
+    }
+    casadi::Sparsity get_sparsity_in(casadi_int i) override final;
+    casadi::Sparsity get_sparsity_out(casadi_int i) override final;
+    bool has_jacobian_sparsity() const override final { return true; }
+    casadi::Sparsity get_jacobian_sparsity() const override final;
+    VectorDM eval(const VectorDM& args) const override;
+
+private:
+    int m_batchSize = -1;
+    const Function* m_pointFunction = nullptr;
+};
+
 } // namespace CasOC
 
 #endif // OPENSIM_CASOCFUNCTION_H
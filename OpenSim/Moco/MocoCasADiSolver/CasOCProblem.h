@@ -137,6 +137,17 @@ public:
         const casadi::DM& derivatives;
         const casadi::DM& parameters;
     };
+    /// The same as ContinuousInput, but for a block of time points: column
+    /// i of each matrix holds the values at the i-th point (times is a row
+    /// vector).
+    struct ContinuousBatchInput {
+        const casadi::DM& times;
+        const casadi::DM& states;
+        const casadi::DM& controls;
+        const casadi::DM& multipliers;
+        const casadi::DM& derivatives;
+        const casadi::DM& parameters;
+    };
     struct CostInput {
         const double& initial_time;
         const casadi::DM& initial_states;
@@ -312,6 +323,12 @@ public:
             bool calcKCErrors, MultibodySystemExplicitOutput& output) const = 0;
     virtual void calcMultibodySystemImplicit(const ContinuousInput& input,
             bool calcKCErrors, MultibodySystemImplicitOutput& output) const = 0;
+    /// The same as calcMultibodySystemImplicit(), but for a block of time
+    /// points; column i of each output matrix holds the outputs for the i-th
+    /// point.
+    virtual void calcMultibodySystemImplicitBatch(
+            const ContinuousBatchInput& input, bool calcKCErrors,
+            MultibodySystemImplicitOutput& output) const = 0;
     virtual void calcVelocityCorrection(const double& time,
             const casadi::DM& multibody_states, const casadi::DM& slacks,
             const casadi::DM& parameters,
@@ -379,9 +396,14 @@ public:
         return it;
     }
 
+    /// If implicitMultibodyBatchSize is positive and the dynamics mode is
+    /// implicit, this also creates the functions returned by
+    /// getImplicitMultibodySystemBatch() and
+    /// getImplicitMultibodySystemBatchIgnoringConstraints().
     void initialize(const std::string& finiteDiffScheme,
             std::shared_ptr<const std::vector<VariablesDM>>
-                    pointsForSparsityDetection) const {
+                    pointsForSparsityDetection,
+            int implicitMultibodyBatchSize = 0) const {
         auto* mutThis = const_cast<Problem*>(this);
 
         {
@@ -442,6 +464,26 @@ public:
                     ->constructFunction(this,
                             "implicit_multibody_system_ignoring_constraints",
                             finiteDiffScheme, pointsForSparsityDetection);
+
+            if (implicitMultibodyBatchSize > 0) {
+                mutThis->m_implicitMultibodyBatchFunc = OpenSim::make_unique<
+                        MultibodySystemImplicitBatch<true>>();
+                mutThis->m_implicitMultibodyBatchFunc->constructFunction(this,
+                        "implicit_multibody_system_batch",
+                        implicitMultibodyBatchSize, *m_implicitMultibodyFunc,
+                        finiteDiffScheme, pointsForSparsityDetection);
+
+                mutThis->m_implicitMultibodyBatchFuncIgnoringConstraints =
+                        OpenSim::make_unique<
+                                MultibodySystemImplicitBatch<false>>();
+                mutThis->m_implicitMultibodyBatchFuncIgnoringConstraints
+                        ->constructFunction(this,
+                                "implicit_multibody_system_batch_ignoring_"
+                                "constraints",
+                                implicitMultibodyBatchSize,
+                                *m_implicitMultibodyFuncIgnoringConstraints,
+                                finiteDiffScheme, pointsForSparsityDetection);
+            }
         } else {
             mutThis->m_multibodyFunc =
                     OpenSim::make_unique<MultibodySystemExplicit<true>>();
@@ -593,6 +635,19 @@ public:
     getImplicitMultibodySystemIgnoringConstraints() const {
         return *m_implicitMultibodyFuncIgnoringConstraints;
     }
+    /// Get a function that evaluates getImplicitMultibodySystem() for a block
+    /// of time points per call. The size of the block is the number of
+    /// columns in each input.
+    const casadi::Function& getImplicitMultibodySystemBatch() const {
+        return *m_implicitMultibodyBatchFunc;
+    }
+    /// Get a function that evaluates
+    /// getImplicitMultibodySystemIgnoringConstraints() for a block of time
+    /// points per call.
+    const casadi::Function&
+    getImplicitMultibodySystemBatchIgnoringConstraints() const {
+        return *m_implicitMultibodyBatchFuncIgnoringConstraints;
+    }
     /// @}
 
 private:
@@ -632,6 +687,10 @@ private:
     std::unique_ptr<MultibodySystemImplicit<true>> m_implicitMultibodyFunc;
     std::unique_ptr<MultibodySystemImplicit<false>>
             m_implicitMultibodyFuncIgnoringConstraints;
+    std::unique_ptr<MultibodySystemImplicitBatch<true>>
+            m_implicitMultibodyBatchFunc;
+    std::unique_ptr<MultibodySystemImplicitBatch<false>>
+            m_implicitMultibodyBatchFuncIgnoringConstraints;
     std::unique_ptr<VelocityCorrection> m_velocityCorrectionFunc;
 };
 
@@ -68,6 +68,12 @@ void Solver::setParallelism(std::string parallelism, int numThreads) {
     m_numThreads = numThreads;
 }
 
+void Solver::setImplicitMultibodyBatchSize(int batchSize) {
+    OPENSIM_THROW_IF(batchSize < 0, OpenSim::Exception,
+            "Expected batchSize >= 0 but got {}.", batchSize);
+    m_implicitMultibodyBatchSize = batchSize;
+}
+
 Solution Solver::solve(const Iterate& guess) const {
     auto transcription = createTranscription();
     auto pointsForSparsityDetection =
@@ -93,7 +99,8 @@ Solution Solver::solve(const Iterate& guess) const {
     }
     m_problem.initialize(m_finite_difference_scheme,
             std::const_pointer_cast<const std::vector<VariablesDM>>(
-                    pointsForSparsityDetection));
+                    pointsForSparsityDetection),
+            m_implicitMultibodyBatchSize);
     return transcription->solve(guess);
 }
 
@@ -171,6 +171,15 @@ public:
         return std::make_pair(m_parallelism, m_numThreads);
     }
 
+    /// If positive, evaluate the implicit multibody dynamics for blocks of
+    /// this many grid points per function call, instead of one grid point
+    /// per call (0, the default). This only applies if the problem's
+    /// dynamics mode is implicit.
+    void setImplicitMultibodyBatchSize(int batchSize);
+    int getImplicitMultibodyBatchSize() const {
+        return m_implicitMultibodyBatchSize;
+    }
+
     void setPluginOptions(casadi::Dict opts) {
         m_pluginOptions = std::move(opts);
     }
@@ -212,6 +221,7 @@ private:
     int m_sparsity_detection_random_count = 3;
     std::string m_parallelism = "serial";
     int m_numThreads = 1;
+    int m_implicitMultibodyBatchSize = 0;
     casadi::Dict m_pluginOptions;
     casadi::Dict m_solverOptions;
     std::string m_optimSolver;
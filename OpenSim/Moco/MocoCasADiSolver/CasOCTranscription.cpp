@@ -386,12 +386,19 @@ void Transcription::transcribe() {
         // the DAE is the same for all grid points, but the evaluation is still
         // done separately to keep implementation general.
 
+        // Evaluate the implicit multibody system for blocks of points (rather
+        // than one point per function call) if requested.
+        const bool useBatches = m_solver.getImplicitMultibodyBatchSize() > 0;
+
         // residual, zdot, kcerr
         // Points where we compute algebraic constraints.
         {
-            const auto out =
-                    evalOnTrajectory(m_problem.getImplicitMultibodySystem(),
-                            inputs, m_meshIndices);
+            const auto out = useBatches
+                    ? evalOnTrajectoryInBatches(
+                              m_problem.getImplicitMultibodySystemBatch(),
+                              inputs, m_meshIndices)
+                    : evalOnTrajectory(m_problem.getImplicitMultibodySystem(),
+                              inputs, m_meshIndices);
             m_constraints.multibody_residuals(Slice(), m_meshIndices) =
                     out.at(0);
             // zdot.
@@ -403,9 +410,15 @@ void Transcription::transcribe() {
 
         // Points where we ignore algebraic constraints.
         if (m_numMeshInteriorPoints) {
-            const auto out = evalOnTrajectory(
-                    m_problem.getImplicitMultibodySystemIgnoringConstraints(),
-                    inputs, m_meshInteriorIndices);
+            const auto out = useBatches
+                    ? evalOnTrajectoryInBatches(
+                              m_problem
+                                      .getImplicitMultibodySystemBatchIgnoringConstraints(),
+                              inputs, m_meshInteriorIndices)
+                    : evalOnTrajectory(
+                              m_problem
+                                      .getImplicitMultibodySystemIgnoringConstraints(),
+                              inputs, m_meshInteriorIndices);
             m_constraints.multibody_residuals(Slice(), m_meshInteriorIndices) =
                     out.at(0);
             // zdot.
@@ -1222,14 +1235,9 @@ Iterate Transcription::createRandomIterateWithinBounds(
     return casIterate;
 }
 
-casadi::MXVector Transcription::evalOnTrajectory(
-        const casadi::Function& pointFunction, const std::vector<Var>& inputs,
+casadi::MXVector Transcription::createTrajectoryInput(
+        const std::vector<Var>& inputs,
         const casadi::Matrix<casadi_int>& timeIndices) const {
-    auto parallelism = m_solver.getParallelism();
-    const auto trajFunc = pointFunction.map(
-            timeIndices.size2(), parallelism.first, parallelism.second);
-
-    // Assemble input.
     // Add 1 for time input and 1 for parameters input.
     MXVector mxIn(inputs.size() + 2);
     mxIn[0] = m_times(timeIndices);
@@ -1256,6 +1264,17 @@ casadi::MXVector Transcription::evalOnTrajectory(
     } else {
         OPENSIM_THROW(OpenSim::Exception, "Internal error.");
     }
+    return mxIn;
+}
+
+casadi::MXVector Transcription::evalOnTrajectory(
+        const casadi::Function& pointFunction, const std::vector<Var>& inputs,
+        const casadi::Matrix<casadi_int>& timeIndices) const {
+    auto parallelism = m_solver.getParallelism();
+    const auto trajFunc = pointFunction.map(
+            timeIndices.size2(), parallelism.first, parallelism.second);
+
+    MXVector mxIn = createTrajectoryInput(inputs, timeIndices);
     MXVector mxOut;
     trajFunc.call(mxIn, mxOut);
     return mxOut;
@@ -1272,4 +1291,39 @@ casadi::MXVector Transcription::evalOnTrajectory(
     }*/
 }
 
+casadi::MXVector Transcription::evalOnTrajectoryInBatches(
+        const casadi::Function& batchFunction, const std::vector<Var>& inputs,
+        const casadi::Matrix<casadi_int>& timeIndices) const {
+    const int numPoints = (int)timeIndices.size2();
+    const int batchSize = (int)batchFunction.size2_in(0);
+    const int numBatches = (numPoints + batchSize - 1) / batchSize;
+    const int numPadding = numBatches * batchSize - numPoints;
+
+    MXVector mxIn = createTrajectoryInput(inputs, timeIndices);
+    if (numPadding) {
+        // The outputs for the repeated points are discarded below.
+        for (auto& in : mxIn) {
+            if (in.size2() != numPoints) continue;
+            const MX lastPoint = in(Slice(), numPoints - 1);
+            in = MX::horzcat({in, MX::repmat(lastPoint, 1, numPadding)});
+        }
+    }
+
+    // Parallelize across batches rather than across points, so that each
+    // thread evaluates whole batches.
+    auto parallelism = m_solver.getParallelism();
+    const auto trajFunc = batchFunction.map(
+            numBatches, parallelism.first, parallelism.second);
+    MXVector mxOut;
+    trajFunc.call(mxIn, mxOut);
+    if (numPadding) {
+        for (auto& out : mxOut) {
+            if (out.size2() > numPoints) {
+                out = out(Slice(), Slice(0, numPoints));
+            }
+        }
+    }
+    return mxOut;
+}
+
 } // namespace CasOC
@@ -81,6 +81,15 @@ protected:
             const std::vector<Var>& inputs,
             const casadi::Matrix<casadi_int>& timeIndices) const;
 
+    /// This is the same as evalOnTrajectory(), except that batchFunction
+    /// evaluates a block of consecutive points (one per column of each input)
+    /// per call. If the number of points is not a multiple of the block size,
+    /// the last block is padded by repeating the last point.
+    casadi::MXVector evalOnTrajectoryInBatches(
+            const casadi::Function& batchFunction,
+            const std::vector<Var>& inputs,
+            const casadi::Matrix<casadi_int>& timeIndices) const;
+
     template <typename TRow, typename TColumn>
     void setVariableBounds(Var var, const TRow& rowIndices,
             const TColumn& columnIndices, const Bounds& bounds) {
@@ -201,6 +210,11 @@ private:
                 "Must provide constraints for interpolating controls.")
     }
 
+    /// Assemble the inputs to evalOnTrajectory(): time, the given
+    /// variables at the given time indices, and parameters.
+    casadi::MXVector createTrajectoryInput(const std::vector<Var>& inputs,
+            const casadi::Matrix<casadi_int>& timeIndices) const;
+
     void transcribe();
     void setObjectiveAndEndpointConstraints();
     void calcDefects() {
@@ -52,6 +52,7 @@ void MocoCasADiSolver::constructProperties() {
     constructProperty_implicit_multibody_accelerations_weight(1.0);
     constructProperty_minimize_implicit_auxiliary_derivatives(false);
     constructProperty_implicit_auxiliary_derivatives_weight(1.0);
+    constructProperty_implicit_multibody_batch_size(0);
 
     constructProperty_enforce_path_constraint_midpoints(false);
 }
@@ -324,6 +325,13 @@ std::unique_ptr<CasOC::Solver> MocoCasADiSolver::createCasOCSolver(
     casSolver->setImplicitAuxiliaryDerivativesWeight(
             get_implicit_auxiliary_derivatives_weight());
 
+    OPENSIM_THROW_IF(get_implicit_multibody_batch_size() < 0, Exception,
+            "Property implicit_multibody_batch_size must be non-negative, but "
+            "it is set to {}.",
+            get_implicit_multibody_batch_size());
+    casSolver->setImplicitMultibodyBatchSize(
+            get_implicit_multibody_batch_size());
+
     casSolver->setOptimSolver(get_optim_solver());
     casSolver->setInterpolateControlMidpoints(
             get_interpolate_control_midpoints());
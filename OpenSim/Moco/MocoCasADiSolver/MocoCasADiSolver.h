@@ -98,6 +98,17 @@ not affect the solution. We encourage you to use the environment variable
 instead, as this allows different users to solve the same problem with the
 parallelization they prefer.
 
+Batched implicit multibody dynamics
+===================================
+With the implicit multibody mode, the multibody dynamics residuals are
+evaluated with inverse dynamics one grid point at a time by default. Setting
+the implicit_multibody_batch_size property to a positive value evaluates the
+residuals for blocks of grid points instead, which reduces the overhead per
+grid point and lets the finite differences perturb every point in a block at
+once. This is most useful for problems with many mesh intervals (e.g., 100 or
+more). When solving in parallel, choose a batch size small enough that there
+are at least as many blocks as parallel jobs.
+
 Parameter variables
 ===================
 By default, MocoCasADiSolver is much slower than MocoTroperSolver at
@@ -112,6 +123,12 @@ will end up with incorrect results if your parameter does indeed require
 Model::initSystem(). To protect against this, ensure that you obtain the
 same results whether this setting is true or false.
 
+When this setting is true and every parameter uses a property kind that
+MocoParameter can push into the existing System (e.g., Body mass properties,
+DeGrooteFregly2016Muscle properties, SmoothSphereHalfSpaceForce contact
+parameters; see MocoParameter), the solver invokes the much cheaper
+Model::initializeState() instead of Model::initSystem().
+
 @note The software license of CasADi (LGPL) is more restrictive than that of
 the rest of Moco (Apache 2.0).
 @note This solver currently only supports systems for which \f$ \dot{q} = u
@@ -171,6 +188,11 @@ public:
             "'minimize_implicit_auxiliary_derivatives' is enabled."
             "Default: 1.0.");
 
+    OpenSim_DECLARE_PROPERTY(implicit_multibody_batch_size, int,
+            "When using the implicit multibody mode, evaluate the multibody "
+            "dynamics for blocks of this many grid points per function call; "
+            "0 (default) evaluates one grid point per call.");
+
     OpenSim_DECLARE_PROPERTY(enforce_path_constraint_midpoints, bool,
             "If the transcription scheme is set to 'hermite-simpson', then "
             "enable this property to enforce MocoPathConstraints at mesh "
@@ -253,3 +253,7 @@ MocoCasOCProblem::MocoCasOCProblem(const MocoCasADiSolver& mocoCasADiSolver,
             fmt::format("delete_this_to_stop_optimization_{}_{}.txt",
                     problemRep.getName(), m_formattedTimeString));
 }
+
+MocoCasOCProblem::~MocoCasOCProblem() {
+    MocoSolver::releaseProblemRepJar(std::move(m_jar));
+}
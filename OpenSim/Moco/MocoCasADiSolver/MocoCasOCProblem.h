@@ -197,6 +197,8 @@ public:
             const MocoProblemRep& mocoProblemRep,
             std::unique_ptr<ThreadsafeJar<const MocoProblemRep>> jar,
             std::string dynamicsMode);
+    /// Returns the MocoProblemReps to MocoSolver's pool, if it is enabled.
+    ~MocoCasOCProblem() override;
 
     int getJarSize() const { return (int)m_jar->size(); }
 
@@ -247,7 +249,72 @@ private:
             bool calcKCErrors,
             MultibodySystemImplicitOutput& output) const override {
         auto mocoProblemRep = m_jar->take();
+        calcMultibodySystemImplicitUsingRep(
+                input, calcKCErrors, mocoProblemRep, output);
+        m_jar->leave(std::move(mocoProblemRep));
+    }
+    void calcMultibodySystemImplicitBatch(const ContinuousBatchInput& input,
+            bool calcKCErrors,
+            MultibodySystemImplicitOutput& output) const override {
+        // Use the same MocoProblemRep for all points in the batch.
+        auto mocoProblemRep = m_jar->take();
+
+        // Copy each point's column of the (column-major) inputs into these
+        // vectors, and copy the outputs back into the point's column.
+        using casadi::DM;
+        DM states = DM::zeros(getNumStates(), 1);
+        DM controls = DM::zeros(getNumControls(), 1);
+        DM multipliers = DM::zeros(getNumMultipliers(), 1);
+        DM derivatives = DM::zeros(getNumDerivatives(), 1);
+        DM parameters = DM::zeros(getNumParameters(), 1);
+        DM multibodyResiduals = DM::zeros(output.multibody_residuals.rows(), 1);
+        DM auxiliaryDerivatives =
+                DM::zeros(output.auxiliary_derivatives.rows(), 1);
+        DM auxiliaryResiduals = DM::zeros(output.auxiliary_residuals.rows(), 1);
+        DM kinematicConstraintErrors =
+                DM::zeros(output.kinematic_constraint_errors.rows(), 1);
+        const auto copyColumnIn = [](const DM& batch, int ipoint, DM& point) {
+            std::copy_n(batch.ptr() + ipoint * point.rows(), point.rows(),
+                    point.ptr());
+        };
+        const auto copyColumnOut = [](const DM& point, int ipoint, DM& batch) {
+            std::copy_n(point.ptr(), point.rows(),
+                    batch.ptr() + ipoint * point.rows());
+        };
+
+        const int numPoints = (int)input.times.columns();
+        for (int ipoint = 0; ipoint < numPoints; ++ipoint) {
+            const double time = *(input.times.ptr() + ipoint);
+            copyColumnIn(input.states, ipoint, states);
+            copyColumnIn(input.controls, ipoint, controls);
+            copyColumnIn(input.multipliers, ipoint, multipliers);
+            copyColumnIn(input.derivatives, ipoint, derivatives);
+            copyColumnIn(input.parameters, ipoint, parameters);
+            ContinuousInput pointInput{time, states, controls, multipliers,
+                    derivatives, parameters};
+            MultibodySystemImplicitOutput pointOutput{multibodyResiduals,
+                    auxiliaryDerivatives, auxiliaryResiduals,
+                    kinematicConstraintErrors};
+            calcMultibodySystemImplicitUsingRep(
+                    pointInput, calcKCErrors, mocoProblemRep, pointOutput);
+            copyColumnOut(multibodyResiduals, ipoint,
+                    output.multibody_residuals);
+            copyColumnOut(auxiliaryDerivatives, ipoint,
+                    output.auxiliary_derivatives);
+            copyColumnOut(auxiliaryResiduals, ipoint,
+                    output.auxiliary_residuals);
+            if (calcKCErrors) {
+                copyColumnOut(kinematicConstraintErrors, ipoint,
+                        output.kinematic_constraint_errors);
+            }
+        }
 
+        m_jar->leave(std::move(mocoProblemRep));
+    }
+    void calcMultibodySystemImplicitUsingRep(const ContinuousInput& input,
+            bool calcKCErrors,
+            const std::unique_ptr<const MocoProblemRep>& mocoProblemRep,
+            MultibodySystemImplicitOutput& output) const {
         // Original model and its associated state. These are used to calculate
         // kinematic constraint forces and errors.
         const auto& modelBase = mocoProblemRep->getModelBase();
@@ -293,8 +360,6 @@ private:
         // Copy auxiliary residuals to output.
         copyImplicitResidualsToOutput(*mocoProblemRep,
                 simtkStateDisabledConstraints, output.auxiliary_residuals);
-
-        m_jar->leave(std::move(mocoProblemRep));
     }
     void calcVelocityCorrection(const double& time,
             const casadi::DM& multibody_states, const casadi::DM& slacks,
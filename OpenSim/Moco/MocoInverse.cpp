@@ -26,6 +26,10 @@
 #include "MocoStudy.h"
 #include "MocoUtilities.h"
 
+#include <OpenSim/Common/Stopwatch.h>
+
+#include <algorithm>
+
 using namespace OpenSim;
 
 void MocoInverse::constructProperties() {
@@ -38,6 +42,9 @@ void MocoInverse::constructProperties() {
     constructProperty_constraint_tolerance(1e-3);
     constructProperty_output_paths();
     constructProperty_reserves_weight(1.0);
+    constructProperty_window_duration();
+    constructProperty_window_overlap(0.1);
+    constructProperty_window_enforce_continuity(true);
 }
 
 MocoStudy MocoInverse::initialize() const { return initializeInternal().first; }
@@ -54,13 +61,13 @@ std::pair<MocoStudy, TimeSeriesTable> MocoInverse::initializeInternal() const {
 
     // Prescribe the kinematics.
     // -------------------------
-    // allowMissingColumns = true: we only need kinematics.
+    // Missing columns are allowed: we only need kinematics.
     // allowExtraColumns = user-specified.
     // assemble = true: we must obey the kinematic constraints.
-    auto statesTraj = StatesTrajectory::createFromStatesTable(model, kinematics,
-            true, get_kinematics_allow_extra_columns(), true);
-
-    auto posmot = PositionMotion::createFromStatesTrajectory(model, statesTraj);
+    // The coordinate splines are fit in parallel, and no StatesTrajectory is
+    // created.
+    auto posmot = PositionMotion::createFromStatesTable(model, kinematics,
+            get_kinematics_allow_extra_columns(), true);
     posmot->setName("position_motion");
     const auto* posmotPtr = posmot.get();
     model.addComponent(posmot.release());
@@ -118,15 +125,21 @@ std::pair<MocoStudy, TimeSeriesTable> MocoInverse::initializeInternal() const {
 }
 
 MocoInverseSolution MocoInverse::solve() const {
+    Stopwatch stopwatch;
     std::pair<MocoStudy, TimeSeriesTable> init = initializeInternal();
+    const long long setupDuration = stopwatch.getElapsedTimeInNs();
+    log_info("MocoInverse setup time: {}", Stopwatch::formatNs(setupDuration));
     const auto& study = init.first;
 
-    MocoSolution mocoSolution = study.solve().unseal();
+    MocoSolution mocoSolution = getProperty_window_duration().empty()
+                                        ? study.solve().unseal()
+                                        : solveWindows(study);
 
     const auto& statesTrajTable = init.second;
     mocoSolution.insertStatesTrajectory(statesTrajTable);
     MocoInverseSolution solution;
     solution.setMocoSolution(mocoSolution);
+    solution.setSetupDuration(1e-9 * (double)setupDuration);
 
     if (getProperty_output_paths().size()) {
         std::vector<std::string> outputPaths;
@@ -141,3 +154,184 @@ MocoInverseSolution MocoInverse::solve() const {
     }
     return solution;
 }
+
+namespace {
+/// Linearly interpolate the trajectory `values`, sampled at `time`, at `t`.
+double interpolate(const SimTK::Vector& time,
+        const SimTK::VectorView& values, double t) {
+    const int n = time.size();
+    if (n == 1 || t <= time[0]) return values[0];
+    if (t >= time[n - 1]) return values[n - 1];
+    const int i = (int)(std::upper_bound(&time[0], &time[0] + n, t) -
+                        &time[0]);
+    const double fraction = (t - time[i - 1]) / (time[i] - time[i - 1]);
+    return values[i - 1] + fraction * (values[i] - values[i - 1]);
+}
+} // anonymous namespace
+
+MocoSolution MocoInverse::solveWindows(const MocoStudy& study) const {
+    const double duration = get_window_duration();
+    const double overlap = get_window_overlap();
+    const bool continuity = get_window_enforce_continuity();
+    OPENSIM_THROW_IF_FRMOBJ(duration <= 0, Exception,
+            "Expected window_duration to be positive, but got {}.", duration);
+    OPENSIM_THROW_IF_FRMOBJ(overlap < 0 || overlap >= duration, Exception,
+            "Expected window_overlap to be non-negative and less than "
+            "window_duration ({}), but got {}.",
+            duration, overlap);
+
+    // Divide the time range into windows.
+    // -----------------------------------
+    const auto& phase = study.getProblem().getPhase(0);
+    const double initialTime = phase.getTimeInitialBounds().getLower();
+    const double finalTime = phase.getTimeFinalBounds().getUpper();
+    std::vector<double> starts;
+    for (int k = 0;; ++k) {
+        starts.push_back(initialTime + k * (duration - overlap));
+        if (starts.back() + duration >= finalTime - SimTK::SignificantReal) {
+            break;
+        }
+    }
+    const int numWindows = (int)starts.size();
+    auto getWindowEnd = [&](int k) {
+        return std::min(starts[k] + duration, finalTime);
+    };
+    // Each window's solution is kept from keepStarts[k] until the next
+    // window's keepStart.
+    std::vector<double> keepStarts(numWindows, initialTime);
+    for (int k = 1; k < numWindows; ++k) {
+        keepStarts[k] = continuity ? starts[k] : starts[k] + 0.5 * overlap;
+    }
+
+    auto createWindowStudy = [&](int k) {
+        MocoStudy windowStudy(study);
+        windowStudy.setName(study.getName() + "_window" + std::to_string(k));
+        auto& problem = windowStudy.updProblem();
+        problem.setTimeBounds(starts[k], getWindowEnd(k));
+        auto& solver = windowStudy.updSolver<MocoCasADiSolver>();
+        solver.set_num_mesh_intervals(std::max(1,
+                (int)std::ceil((getWindowEnd(k) - starts[k]) /
+                               get_mesh_interval())));
+        return windowStudy;
+    };
+
+    // Solve the windows.
+    // ------------------
+    Stopwatch stopwatch;
+    std::vector<MocoSolution> solutions(numWindows);
+    auto logWindow = [&](int k) {
+        log_info("MocoInverse: window {} of {} ([{}, {}] s): {} after {} "
+                 "iterations.",
+                k + 1, numWindows, starts[k], getWindowEnd(k),
+                solutions[k].getStatus(), solutions[k].getNumIterations());
+    };
+    if (continuity) {
+        for (int k = 0; k < numWindows; ++k) {
+            MocoStudy windowStudy = createWindowStudy(k);
+            if (k > 0) {
+                auto& problem = windowStudy.updProblem();
+                const MocoSolution& previous = solutions[k - 1];
+                for (const auto& name : previous.getStateNames()) {
+                    problem.setStateInfo(name, {},
+                            interpolate(previous.getTime(),
+                                    previous.getState(name), starts[k]));
+                }
+                // The initial activations are fixed, so the initial
+                // excitations need not match them.
+                problem.updGoal("initial_activation").setEnabled(false);
+            }
+            solutions[k] = windowStudy.solve().unseal();
+            logWindow(k);
+        }
+    } else {
+        // The windows are independent, but they are solved one after another:
+        // IPOPT and its linear solver (MUMPS) are not thread-safe, so
+        // solving several windows at once in one process is not allowed.
+        // Each window still uses the solver's own parallelism.
+        for (int k = 0; k < numWindows; ++k) {
+            solutions[k] = createWindowStudy(k).solve().unseal();
+            logWindow(k);
+        }
+    }
+    const double wallTime = 1e-9 * (double)stopwatch.getElapsedTimeInNs();
+
+    // Stitch the window solutions.
+    // ----------------------------
+    std::vector<std::vector<int>> keptRows(numWindows);
+    int numTimes = 0;
+    for (int k = 0; k < numWindows; ++k) {
+        const auto& time = solutions[k].getTime();
+        const double keepEnd = k + 1 < numWindows ? keepStarts[k + 1]
+                                                  : SimTK::Infinity;
+        for (int i = 0; i < time.size(); ++i) {
+            if (time[i] >= keepStarts[k] && time[i] < keepEnd) {
+                keptRows[k].push_back(i);
+            }
+        }
+        numTimes += (int)keptRows[k].size();
+    }
+    auto stitch = [&](const SimTK::Matrix& (MocoTrajectory::*getTrajectory)()
+                              const,
+                          const std::vector<std::string>& names,
+                          void (MocoTrajectory::*setColumn)(
+                                  const std::string&, const SimTK::Vector&),
+                          MocoSolution& stitched) {
+        SimTK::Vector column(numTimes);
+        for (int j = 0; j < (int)names.size(); ++j) {
+            int row = 0;
+            for (int k = 0; k < numWindows; ++k) {
+                const SimTK::Matrix& data = (solutions[k].*getTrajectory)();
+                for (int i : keptRows[k]) column[row++] = data(i, j);
+            }
+            (stitched.*setColumn)(names[j], column);
+        }
+    };
+
+    MocoSolution stitched = solutions[0];
+    stitched.setNumTimes(numTimes);
+    {
+        SimTK::Vector time(numTimes);
+        int row = 0;
+        for (int k = 0; k < numWindows; ++k) {
+            for (int i : keptRows[k]) time[row++] = solutions[k].getTime()[i];
+        }
+        stitched.setTime(time);
+    }
+    stitch(&MocoTrajectory::getStatesTrajectory, stitched.getStateNames(),
+            &MocoTrajectory::setState, stitched);
+    stitch(&MocoTrajectory::getControlsTrajectory, stitched.getControlNames(),
+            &MocoTrajectory::setControl, stitched);
+    stitch(&MocoTrajectory::getMultipliersTrajectory,
+            stitched.getMultiplierNames(), &MocoTrajectory::setMultiplier,
+            stitched);
+    stitch(&MocoTrajectory::getDerivativesTrajectory,
+            stitched.getDerivativeNames(), &MocoTrajectory::setDerivative,
+            stitched);
+    stitch(&MocoTrajectory::getSlacksTrajectory, stitched.getSlackNames(),
+            &MocoTrajectory::setSlack, stitched);
+
+    bool success = true;
+    std::string status = solutions.back().getStatus();
+    double objective = 0;
+    int numIterations = 0;
+    std::vector<std::pair<std::string, double>> breakdown =
+            solutions[0].m_objectiveBreakdown;
+    for (auto& term : breakdown) term.second = 0;
+    for (const auto& solution : solutions) {
+        if (success && !solution.success()) status = solution.getStatus();
+        success = success && solution.success();
+        objective += solution.getObjective();
+        numIterations += solution.getNumIterations();
+        for (int i = 0; i < (int)breakdown.size(); ++i) {
+            breakdown[i].second += solution.m_objectiveBreakdown[i].second;
+        }
+    }
+    stitched.setObjective(objective);
+    stitched.setObjectiveBreakdown(breakdown);
+    stitched.setStatus(status);
+    stitched.setNumIterations(numIterations);
+    stitched.setSolverDuration(wallTime);
+    stitched.setSuccess(success);
+    // solve() expects an unsealed solution.
+    return stitched.unseal();
+}
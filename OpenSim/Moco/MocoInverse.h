@@ -36,6 +36,10 @@ class MocoInverseSolution {
 public:
     const MocoSolution& getMocoSolution() const { return m_mocoSolution; }
     const TimeSeriesTable& getOutputs() const { return m_outputs; }
+    /// Get the amount of time (clock time, not CPU time) spent processing the
+    /// inputs and setting up the MocoStudy before solving (i.e., not
+    /// included in MocoSolution::getSolverDuration()). Units: seconds.
+    double getSetupDuration() const { return m_setupDuration; }
 private:
     void setMocoSolution(MocoSolution mocoSolution) {
         m_mocoSolution = std::move(mocoSolution);
@@ -43,8 +47,12 @@ private:
     void setOutputs(TimeSeriesTable outputs) {
         m_outputs = std::move(outputs);
     }
+    void setSetupDuration(double setupDuration) {
+        m_setupDuration = setupDuration;
+    }
     MocoSolution m_mocoSolution;
     TimeSeriesTable m_outputs;
+    double m_setupDuration = SimTK::NaN;
     friend class MocoInverse;
 };
 
@@ -71,6 +79,27 @@ costs manually, and solve the problem using the solver directly. Note,
 however, that kinematic states are not included in the solution if you use
 the solver directly.
 
+# Receding horizon
+Long trials produce large optimization problems whose memory use and solve
+time grow faster than the trial length. Setting `window_duration` solves the
+trial as a sequence of overlapping windows instead, each with
+`window_duration` seconds of kinematics; consecutive windows start
+`window_duration - window_overlap` seconds apart. By default
+(`window_enforce_continuity` = true), windows are solved in order, and the
+initial value of every state in a window is fixed to the value from the
+previous window (so the initial activation goal applies only to the first
+window); each window's solution is kept up to the start of the next window,
+and the remainder of the window (the overlap) serves as a look-ahead. If
+`window_enforce_continuity` is false, the windows are independent (they are
+still solved one after another, since IPOPT is not thread-safe), and the
+solutions are joined at the middle of each overlap, where the effects of the
+window endpoints have decayed. In both cases the mesh interval of each window
+is approximately `mesh_interval`, and the window solutions are stitched into a
+single MocoSolution whose objective, iterations, and breakdown are summed over
+the windows and whose solver duration is the total wall time. The states,
+controls, multipliers, derivatives, and slacks are stitched; the parameters
+are taken from the first window.
+
 # Default solver settings
 - solver: MocoCasADiSolver
 - multibody_dynamics_mode: implicit
@@ -192,6 +221,21 @@ public:
             "the model operator ModOpAddReserves, which names each appended "
             "actuator in this format. Default weight: 1.");
 
+    OpenSim_DECLARE_OPTIONAL_PROPERTY(window_duration, double,
+            "Solve the problem in overlapping time windows of this duration "
+            "(seconds) rather than all at once (default: not set; solve the "
+            "full time range at once).");
+
+    OpenSim_DECLARE_PROPERTY(window_overlap, double,
+            "Duration (seconds) by which consecutive windows overlap; must be "
+            "less than window_duration (default: 0.1).");
+
+    OpenSim_DECLARE_PROPERTY(window_enforce_continuity, bool,
+            "Solve windows in order, fixing the initial states of each "
+            "window to the states of the previous window (default: true). "
+            "If false, solve the windows independently and join them at "
+            "the middle of each overlap.");
+
     MocoInverse() { constructProperties(); }
 
     void setKinematics(TableProcessor kinematics) {
@@ -206,6 +250,8 @@ public:
 private:
     void constructProperties();
     std::pair<MocoStudy, TimeSeriesTable> initializeInternal() const;
+    /// Solve the study in overlapping windows and stitch the solutions.
+    MocoSolution solveWindows(const MocoStudy& study) const;
 };
 
 } // namespace OpenSim
@@ -0,0 +1,537 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: MocoInverseOnline.cpp                                             *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2022 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoInverseOnline.h"
+
+#include <OpenSim/Actuators/CoordinateActuator.h>
+#include <OpenSim/Actuators/DeGrooteFregly2016Muscle.h>
+#include <OpenSim/Common/Stopwatch.h>
+#include <OpenSim/Simulation/Model/Model.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace OpenSim;
+
+/// The processed model and the data that is reused from frame to frame. The
+/// vectors with one entry per actuator are in the order of actuatorPaths.
+struct MocoInverseOnline::Workspace {
+    explicit Workspace(const Model& processedModel) : model(processedModel) {}
+    Model model;
+    SimTK::State state;
+
+    std::vector<std::string> actuatorPaths;
+    /// nullptr if the actuator is not a muscle.
+    std::vector<const DeGrooteFregly2016Muscle*> muscles;
+    /// nullptr if the actuator is not a PathActuator (muscles included).
+    std::vector<const PathActuator*> pathActuators;
+    /// The u index of the coordinate driven by a CoordinateActuator; -1
+    /// otherwise.
+    std::vector<int> mobilityIndices;
+    /// Optimal force of the non-muscle actuators.
+    SimTK::Vector optimalForces;
+    SimTK::Vector weights;
+    SimTK::Vector minControls;
+    SimTK::Vector maxControls;
+
+    // The previous frame.
+    bool hasPrevious = false;
+    double previousTime = SimTK::NaN;
+    SimTK::Vector previousActivations;
+    /// For each variable: -1 if at its lower bound, 1 if at its upper bound,
+    /// and 0 if free.
+    std::vector<int> activeBounds;
+
+    // Scratch space.
+    SimTK::Vector_<SimTK::SpatialVec> bodyForces;
+    SimTK::Vector_<SimTK::SpatialVec> pathBodyForces;
+    SimTK::Vector mobilityForces;
+    SimTK::Vector pathMobilityForces;
+    SimTK::Vector pathGeneralizedForces;
+    SimTK::Vector residual;
+    /// Generalized force per unit control, one column per actuator.
+    SimTK::Matrix A;
+    SimTK::Matrix G;
+    SimTK::Matrix GGt;
+    SimTK::Matrix GA;
+    SimTK::Vector Gresidual;
+    SimTK::Matrix Y;
+    SimTK::Vector y;
+    SimTK::FactorQTZ factorization;
+    /// The equality constraints C x = d, with the directions in which the
+    /// kinematic constraints can apply forces removed.
+    SimTK::Matrix C;
+    SimTK::Vector d;
+    SimTK::Matrix K;
+    SimTK::Vector r;
+    SimTK::Vector mu;
+    SimTK::Vector lower;
+    SimTK::Vector upper;
+    SimTK::Vector x;
+    /// Step from x toward the solution for the current active set.
+    SimTK::Vector step;
+
+    MocoInverseOnlineFrame frame;
+};
+
+MocoInverseOnline::MocoInverseOnline() { constructProperties(); }
+MocoInverseOnline::MocoInverseOnline(const MocoInverseOnline&) = default;
+MocoInverseOnline& MocoInverseOnline::operator=(
+        const MocoInverseOnline&) = default;
+MocoInverseOnline::~MocoInverseOnline() = default;
+
+void MocoInverseOnline::constructProperties() {
+    constructProperty_model(ModelProcessor());
+    constructProperty_reserves_weight(1.0);
+    constructProperty_enforce_activation_dynamics(true);
+    constructProperty_time_budget(0.005);
+    constructProperty_max_iterations(100);
+    constructProperty_convergence_tolerance(1e-8);
+}
+
+void MocoInverseOnline::initialize() {
+    OPENSIM_THROW_IF_FRMOBJ(get_reserves_weight() <= 0, Exception,
+            fmt::format("Expected reserves_weight to be positive, but got {}.",
+                    get_reserves_weight()));
+    OPENSIM_THROW_IF_FRMOBJ(get_time_budget() <= 0, Exception,
+            fmt::format("Expected time_budget to be positive, but got {}.",
+                    get_time_budget()));
+    OPENSIM_THROW_IF_FRMOBJ(get_max_iterations() < 1, Exception,
+            fmt::format("Expected max_iterations to be at least 1, but got "
+                        "{}.",
+                    get_max_iterations()));
+
+    std::string documentDirectory;
+    {
+        bool dontApplySearchPath;
+        std::string fileName, extension;
+        SimTK::Pathname::deconstructPathname(getDocumentFileName(),
+                dontApplySearchPath, documentDirectory, fileName, extension);
+    }
+
+    m_workspace.reset(new Workspace(get_model().process(documentDirectory)));
+    auto& ws = *m_workspace;
+    ws.state = ws.model.initSystem();
+
+    std::vector<const ScalarActuator*> actuators;
+    for (const auto& actu : ws.model.getComponentList<Actuator>()) {
+        if (!actu.get_appliesForce()) continue;
+        const auto* scalarActu = dynamic_cast<const ScalarActuator*>(&actu);
+        OPENSIM_THROW_IF_FRMOBJ(!scalarActu, Exception,
+                fmt::format("Actuator '{}' is not a ScalarActuator.",
+                        actu.getAbsolutePathString()));
+        actuators.push_back(scalarActu);
+    }
+
+    const int na = (int)actuators.size();
+    ws.muscles.assign(na, nullptr);
+    ws.pathActuators.assign(na, nullptr);
+    ws.mobilityIndices.assign(na, -1);
+    ws.optimalForces.resize(na);
+    ws.optimalForces = SimTK::NaN;
+    ws.weights.resize(na);
+    ws.minControls.resize(na);
+    ws.maxControls.resize(na);
+    for (int j = 0; j < na; ++j) {
+        const auto& actu = *actuators[j];
+        ws.actuatorPaths.push_back(actu.getAbsolutePathString());
+        ws.weights[j] =
+                ws.actuatorPaths.back().find("/reserve_") != std::string::npos
+                        ? get_reserves_weight()
+                        : 1.0;
+        ws.minControls[j] = actu.getMinControl();
+        ws.maxControls[j] = actu.getMaxControl();
+        if (const auto* muscle = dynamic_cast<const Muscle*>(&actu)) {
+            const auto* dgf =
+                    dynamic_cast<const DeGrooteFregly2016Muscle*>(muscle);
+            OPENSIM_THROW_IF_FRMOBJ(!dgf, Exception,
+                    fmt::format("Muscle '{}' is not a "
+                                "DeGrooteFregly2016Muscle; consider using "
+                                "ModOpReplaceMusclesWithDeGrooteFregly2016.",
+                            ws.actuatorPaths.back()));
+            OPENSIM_THROW_IF_FRMOBJ(!dgf->get_ignore_tendon_compliance(),
+                    Exception,
+                    fmt::format("Muscle '{}' has a compliant tendon, but only "
+                                "rigid tendons are supported; consider using "
+                                "ModOpIgnoreTendonCompliance.",
+                            ws.actuatorPaths.back()));
+            ws.muscles[j] = dgf;
+            ws.pathActuators[j] = dgf;
+        } else if (const auto* pathActu =
+                           dynamic_cast<const PathActuator*>(&actu)) {
+            ws.pathActuators[j] = pathActu;
+            ws.optimalForces[j] = pathActu->getOptimalForce();
+        } else if (const auto* coordActu =
+                           dynamic_cast<const CoordinateActuator*>(&actu)) {
+            ws.optimalForces[j] = coordActu->getOptimalForce();
+            const Coordinate* coord = coordActu->getCoordinate();
+            ws.mobilityIndices[j] =
+                    coord->getStateVariableSystemIndex("speed") -
+                    ws.state.getUStart();
+        } else {
+            OPENSIM_THROW_FRMOBJ(Exception,
+                    fmt::format("Actuator '{}' has type {}, but only "
+                                "CoordinateActuator and PathActuator (and "
+                                "their subclasses) are supported.",
+                            ws.actuatorPaths.back(),
+                            actu.getConcreteClassName()));
+        }
+        OPENSIM_THROW_IF_FRMOBJ(ws.minControls[j] > ws.maxControls[j],
+                Exception,
+                fmt::format("Actuator '{}' has min_control greater than "
+                            "max_control.",
+                        ws.actuatorPaths.back()));
+
+        // The actuators apply no force when computing the applied forces;
+        // their (and the passive muscle) forces enter through the QP.
+        actu.overrideActuation(ws.state, true);
+        actu.setOverrideActuation(ws.state, 0);
+    }
+
+    const int nu = ws.state.getNU();
+    const int nc = ws.model.getMatterSubsystem()
+                           .getNumConstraintEquationsInUse(ws.state);
+    ws.A.resize(nu, na);
+    ws.G.resize(nc, nu);
+    ws.GGt.resize(nc, nc);
+    ws.GA.resize(nc, na);
+    ws.Gresidual.resize(nc);
+    ws.Y.resize(nc, na);
+    ws.y.resize(nc);
+    ws.C.resize(nu, na);
+    ws.d.resize(nu);
+    ws.K.resize(nu, nu);
+    ws.x.resize(na);
+    ws.step.resize(na);
+    ws.activeBounds.assign(na, 0);
+    ws.previousActivations.resize(na);
+
+    ws.frame.activations.resize(na);
+    ws.frame.controls.resize(na);
+}
+
+const Model& MocoInverseOnline::getModel() const {
+    OPENSIM_THROW_IF_FRMOBJ(!m_workspace, Exception,
+            "Expected initialize() to have been called.");
+    return m_workspace->model;
+}
+
+const std::vector<std::string>& MocoInverseOnline::getActuatorPaths() const {
+    OPENSIM_THROW_IF_FRMOBJ(!m_workspace, Exception,
+            "Expected initialize() to have been called.");
+    return m_workspace->actuatorPaths;
+}
+
+void MocoInverseOnline::reset() {
+    if (!m_workspace) return;
+    m_workspace->hasPrevious = false;
+    std::fill(m_workspace->activeBounds.begin(),
+            m_workspace->activeBounds.end(), 0);
+}
+
+const MocoInverseOnlineFrame& MocoInverseOnline::solveFrame(double time,
+        const SimTK::Vector& q, const SimTK::Vector& u,
+        const SimTK::Vector& udot,
+        const SimTK::Vector_<SimTK::SpatialVec>& externalBodyForces) {
+    Stopwatch stopwatch;
+    OPENSIM_THROW_IF_FRMOBJ(!m_workspace, Exception,
+            "Expected initialize() to have been called.");
+    auto& ws = *m_workspace;
+    auto& s = ws.state;
+    const int nu = s.getNU();
+    const int na = (int)ws.actuatorPaths.size();
+    OPENSIM_THROW_IF_FRMOBJ(q.size() != s.getNQ() || u.size() != nu ||
+                                    udot.size() != nu,
+            Exception,
+            fmt::format("Expected q, u, and udot to have sizes {}, {}, and "
+                        "{}, but got {}, {}, and {}.",
+                    s.getNQ(), nu, nu, q.size(), u.size(), udot.size()));
+    OPENSIM_THROW_IF_FRMOBJ(externalBodyForces.size() != 0 &&
+                                    externalBodyForces.size() !=
+                                            s.getNB(),
+            Exception,
+            fmt::format("Expected externalBodyForces to have size {}, but "
+                        "got {}.",
+                    s.getNB(), externalBodyForces.size()));
+
+    // Net generalized forces required from the actuators.
+    // ---------------------------------------------------
+    s.setTime(time);
+    s.updQ() = q;
+    s.updU() = u;
+    const auto& system = ws.model.getMultibodySystem();
+    const auto& matter = ws.model.getMatterSubsystem();
+    ws.model.realizeDynamics(s);
+    ws.bodyForces = system.getRigidBodyForces(s, SimTK::Stage::Dynamics);
+    ws.mobilityForces = system.getMobilityForces(s, SimTK::Stage::Dynamics);
+    if (externalBodyForces.size()) ws.bodyForces += externalBodyForces;
+    matter.calcResidualForceIgnoringConstraints(
+            s, ws.mobilityForces, ws.bodyForces, udot, ws.residual);
+
+    // Generalized force per unit control.
+    // -----------------------------------
+    // With a rigid tendon, muscle force is the passive force plus activation
+    // times the active force at full activation. The passive force is moved
+    // to the right side of the equality.
+    for (int j = 0; j < na; ++j) {
+        auto column = ws.A.updCol(j);
+        if (ws.mobilityIndices[j] >= 0) {
+            column.setToZero();
+            column[ws.mobilityIndices[j]] = ws.optimalForces[j];
+            continue;
+        }
+        ws.pathBodyForces.resize(s.getNB());
+        ws.pathBodyForces.setToZero();
+        ws.pathMobilityForces.resize(nu);
+        ws.pathMobilityForces.setToZero();
+        ws.pathActuators[j]->getGeometryPath().addInEquivalentForces(
+                s, 1.0, ws.pathBodyForces, ws.pathMobilityForces);
+        matter.multiplySystemJacobianTranspose(
+                s, ws.pathBodyForces, ws.pathGeneralizedForces);
+        ws.pathGeneralizedForces += ws.pathMobilityForces;
+        if (const auto* muscle = ws.muscles[j]) {
+            const double activeForce =
+                    muscle->getMaxIsometricForce() *
+                    muscle->getActiveForceLengthMultiplier(s) *
+                    muscle->getForceVelocityMultiplier(s) *
+                    muscle->getCosPennationAngle(s);
+            ws.residual -= muscle->getPassiveFiberForceAlongTendon(s) *
+                           ws.pathGeneralizedForces;
+            column = activeForce * ws.pathGeneralizedForces;
+        } else {
+            column = ws.optimalForces[j] * ws.pathGeneralizedForces;
+        }
+    }
+
+    // Remove the directions in which the kinematic constraints apply forces:
+    // C = (I - G^T (G G^T)^+ G) A and d = (I - G^T (G G^T)^+ G) residual.
+    // The products are formed in the workspace to avoid allocating.
+    matter.calcG(s, ws.G);
+    const int nc = ws.G.nrow();
+    ws.C = ws.A;
+    ws.d = ws.residual;
+    if (nc) {
+        for (int a = 0; a < nc; ++a) {
+            for (int b = 0; b < nc; ++b) {
+                double sum = 0;
+                for (int i = 0; i < nu; ++i) sum += ws.G(a, i) * ws.G(b, i);
+                ws.GGt(a, b) = sum;
+            }
+            for (int j = 0; j < na; ++j) {
+                double sum = 0;
+                for (int i = 0; i < nu; ++i) sum += ws.G(a, i) * ws.A(i, j);
+                ws.GA(a, j) = sum;
+            }
+            double sum = 0;
+            for (int i = 0; i < nu; ++i) sum += ws.G(a, i) * ws.residual[i];
+            ws.Gresidual[a] = sum;
+        }
+        ws.factorization.factor<double>(ws.GGt);
+        ws.factorization.solve(ws.GA, ws.Y);
+        ws.factorization.solve(ws.Gresidual, ws.y);
+        for (int a = 0; a < nc; ++a) {
+            for (int i = 0; i < nu; ++i) {
+                const double g = ws.G(a, i);
+                if (g == 0) continue;
+                for (int j = 0; j < na; ++j) ws.C(i, j) -= g * ws.Y(a, j);
+                ws.d[i] -= g * ws.y[a];
+            }
+        }
+    }
+
+    // Bounds.
+    // -------
+    const double dt = time - ws.previousTime;
+    const bool coupled = ws.hasPrevious && get_enforce_activation_dynamics() &&
+                         dt > 0;
+    ws.lower = ws.minControls;
+    ws.upper = ws.maxControls;
+    for (int j = 0; j < na; ++j) {
+        const auto* muscle = ws.muscles[j];
+        if (!coupled || !muscle || muscle->get_ignore_activation_dynamics()) {
+            continue;
+        }
+        // The reachable activations for excitations between min_control and
+        // max_control, using a forward Euler step of the De Groote et al.
+        // (2016) activation dynamics.
+        const double a0 = ws.previousActivations[j];
+        const double factor = 0.5 + 1.5 * a0;
+        ws.upper[j] = std::min(ws.upper[j],
+                a0 + dt * (ws.maxControls[j] - a0) /
+                                (muscle->get_activation_time_constant() *
+                                        factor));
+        ws.lower[j] = std::max(ws.lower[j],
+                a0 + dt * (ws.minControls[j] - a0) * factor /
+                                muscle->get_deactivation_time_constant());
+        ws.lower[j] = std::min(ws.lower[j], ws.upper[j]);
+    }
+
+    // Active-set method.
+    // ------------------
+    // minimize sum_j w_j x_j^2 subject to C x = d and lower <= x <= upper.
+    // For the current set of variables fixed at their bounds, the free
+    // variables of the solution are x_F = W_F^-1 C_F^T mu, with
+    // C_F W_F^-1 C_F^T mu = r, where r = d - C_B x_B. The factorization
+    // handles a rank-deficient C_F (e.g., if the actuators cannot produce
+    // some generalized force) in the least-squares sense. The iterate x
+    // always satisfies the bounds: each iteration steps from x toward the
+    // solution for the current active set and, if a bound blocks the step,
+    // stops there and fixes that one variable at its bound. Once the step is
+    // not blocked, one fixed variable whose multiplier has the wrong sign is
+    // released.
+    auto& bounds = ws.activeBounds;
+    if (!ws.hasPrevious) std::fill(bounds.begin(), bounds.end(), 0);
+    for (int j = 0; j < na; ++j) {
+        if (bounds[j]) {
+            ws.x[j] = bounds[j] < 0 ? ws.lower[j] : ws.upper[j];
+        } else {
+            // Start from the previous frame's solution, if any.
+            ws.x[j] = SimTK::clamp(ws.lower[j],
+                    ws.hasPrevious ? ws.previousActivations[j] : 0.0,
+                    ws.upper[j]);
+        }
+    }
+    const double tol = get_convergence_tolerance();
+    const long long budget = std::llround(get_time_budget() * 1e9);
+    const auto columnDot = [&](int j, const SimTK::Vector& v) {
+        double sum = 0;
+        for (int i = 0; i < nu; ++i) sum += ws.C(i, j) * v[i];
+        return sum;
+    };
+    int numIterations = 0;
+    bool converged = false;
+    while (numIterations < get_max_iterations()) {
+        if (numIterations && stopwatch.getElapsedTimeInNs() > budget) break;
+        ++numIterations;
+
+        ws.r = ws.d;
+        ws.K.setToZero();
+        for (int j = 0; j < na; ++j) {
+            if (bounds[j]) {
+                for (int i = 0; i < nu; ++i) ws.r[i] -= ws.C(i, j) * ws.x[j];
+            } else {
+                for (int b = 0; b < nu; ++b) {
+                    const double cbw = ws.C(b, j) / ws.weights[j];
+                    if (cbw == 0) continue;
+                    for (int a = b; a < nu; ++a) {
+                        ws.K(a, b) += ws.C(a, j) * cbw;
+                    }
+                }
+            }
+        }
+        for (int b = 0; b < nu; ++b) {
+            for (int a = b + 1; a < nu; ++a) ws.K(b, a) = ws.K(a, b);
+        }
+        ws.factorization.factor<double>(ws.K);
+        ws.factorization.solve(ws.r, ws.mu);
+
+        // Ratio test: the largest step toward the solution for the current
+        // active set that keeps the free variables within their bounds.
+        double stepLength = 1;
+        int blocking = -1;
+        int blockingBound = 0;
+        for (int j = 0; j < na; ++j) {
+            if (bounds[j]) continue;
+            const double target = columnDot(j, ws.mu) / ws.weights[j];
+            ws.step[j] = target - ws.x[j];
+            double length = SimTK::Infinity;
+            int bound = 0;
+            if (target < ws.lower[j] - tol) {
+                length = (ws.lower[j] - ws.x[j]) / ws.step[j];
+                bound = -1;
+            } else if (target > ws.upper[j] + tol) {
+                length = (ws.upper[j] - ws.x[j]) / ws.step[j];
+                bound = 1;
+            }
+            if (length < stepLength) {
+                stepLength = std::max(0.0, length);
+                blocking = j;
+                blockingBound = bound;
+            }
+        }
+        for (int j = 0; j < na; ++j) {
+            if (!bounds[j]) ws.x[j] += stepLength * ws.step[j];
+        }
+        if (blocking >= 0) {
+            // Fix only the variable that blocks the step.
+            bounds[blocking] = blockingBound;
+            ws.x[blocking] =
+                    blockingBound < 0 ? ws.lower[blocking] : ws.upper[blocking];
+            continue;
+        }
+
+        // x solves the problem for the current active set. Release the fixed
+        // variable whose multiplier has the wrong sign by the largest amount;
+        // the cost decreases by moving it off its bound.
+        int release = -1;
+        double worst = tol;
+        for (int j = 0; j < na; ++j) {
+            if (!bounds[j]) continue;
+            const double gradient =
+                    ws.weights[j] * ws.x[j] - columnDot(j, ws.mu);
+            if (bounds[j] * gradient > worst) {
+                worst = bounds[j] * gradient;
+                release = j;
+            }
+        }
+        if (release < 0) {
+            converged = true;
+            break;
+        }
+        bounds[release] = 0;
+    }
+
+    // Store the frame.
+    // ----------------
+    auto& frame = ws.frame;
+    frame.time = time;
+    frame.objective = 0;
+    for (int j = 0; j < na; ++j) {
+        ws.x[j] = SimTK::clamp(ws.lower[j], ws.x[j], ws.upper[j]);
+        frame.objective += ws.weights[j] * SimTK::square(ws.x[j]);
+        frame.activations[j] = ws.x[j];
+        frame.controls[j] = ws.x[j];
+        const auto* muscle = ws.muscles[j];
+        if (!coupled || !muscle || muscle->get_ignore_activation_dynamics()) {
+            continue;
+        }
+        // Invert the activation dynamics used for the bounds.
+        const double a0 = ws.previousActivations[j];
+        const double factor = 0.5 + 1.5 * a0;
+        const double timeConstant =
+                ws.x[j] > a0 ? muscle->get_activation_time_constant() * factor
+                             : muscle->get_deactivation_time_constant() /
+                                       factor;
+        frame.controls[j] = SimTK::clamp(ws.minControls[j],
+                a0 + (ws.x[j] - a0) * timeConstant / dt, ws.maxControls[j]);
+    }
+    double violation = 0;
+    for (int i = 0; i < nu; ++i) {
+        double Cx = 0;
+        for (int j = 0; j < na; ++j) Cx += ws.C(i, j) * ws.x[j];
+        violation += SimTK::square(Cx - ws.d[i]);
+    }
+    frame.constraintViolation = std::sqrt(violation);
+    frame.numIterations = numIterations;
+    frame.success = converged;
+
+    ws.previousActivations = ws.x;
+    ws.previousTime = time;
+    ws.hasPrevious = true;
+
+    frame.solverDuration = 1e-9 * (double)stopwatch.getElapsedTimeInNs();
+    return frame;
+}
@@ -0,0 +1,180 @@
+#ifndef OPENSIM_MOCOINVERSEONLINE_H
+#define OPENSIM_MOCOINVERSEONLINE_H
+/* -------------------------------------------------------------------------- *
+ * OpenSim: MocoInverseOnline.h                                               *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2022 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimMocoDLL.h"
+
+#include <memory>
+
+#include <OpenSim/Actuators/ModelProcessor.h>
+#include <OpenSim/Common/Object.h>
+
+namespace OpenSim {
+
+/** The solution of MocoInverseOnline for a single frame. Each vector has one
+entry per actuator, in the order given by
+MocoInverseOnline::getActuatorPaths(). */
+struct MocoInverseOnlineFrame {
+    double time = SimTK::NaN;
+    /// Muscle activations. For actuators without activation dynamics, this is
+    /// the same as the control.
+    SimTK::Vector activations;
+    /// Muscle excitations (the excitation that, through the muscle's
+    /// activation dynamics, takes the previous frame's activation to this
+    /// frame's activation) and the controls of all other actuators.
+    SimTK::Vector controls;
+    /// Sum of squared activations/controls, including the reserves weight.
+    double objective = SimTK::NaN;
+    /// Norm of the generalized forces (in the space not spanned by the
+    /// kinematic constraints) that the actuators fail to produce. This is
+    /// only nonzero if the actuators are too weak or the time budget ran out.
+    double constraintViolation = SimTK::NaN;
+    /// Number of active-set iterations.
+    int numIterations = 0;
+    /// The active-set method converged within max_iterations and time_budget.
+    bool success = false;
+    /// Clock time spent in solveFrame(). Units: seconds.
+    double solverDuration = SimTK::NaN;
+};
+
+/** This class estimates muscle activations frame by frame from streaming
+kinematics (and, optionally, streaming external forces), for applications
+such as real-time biofeedback in which MocoInverse, which solves the entire
+motion at once, cannot be used.
+
+Each frame solves the same kind of problem as MocoInverse, but only at a
+single time: find the activations and reserve controls that minimize the sum
+of squared activations/controls (controls whose path contains "/reserve_"
+are weighted by reserves_weight) such that the actuators produce the net
+generalized forces required by the kinematics. Muscles must be
+DeGrooteFregly2016Muscle%s with rigid tendons (see
+ModOpReplaceMusclesWithDeGrooteFregly2016 and ModOpIgnoreTendonCompliance).
+With a rigid tendon, tendon force is affine in activation, so each frame is a
+small quadratic program with bounds on the variables, which this class solves
+with an active-set method.
+
+# Activation dynamics
+Successive frames are coupled through the muscles' activation dynamics: the
+activation in one frame is bounded by the activations that excitations
+between min_control and max_control can reach (with a forward Euler step)
+from the previous frame's activation. The excitations reported in
+MocoInverseOnlineFrame::controls are those that produce the solved
+activations. The first frame, and any frame after reset(), is not coupled to
+a previous frame.
+
+# Time budget
+Each frame is warm-started with the set of bounds that were active in the
+previous frame, so that the active-set method usually converges in a few
+iterations. The iterations stop once the clock time spent in the frame
+exceeds time_budget; the frame then contains the latest iterate, which is
+within the variable bounds but may not achieve the required generalized forces
+(see constraintViolation), with success set to false. At least one iteration is
+always performed, so the budget cannot be met if it is smaller than the time
+to compute the dynamics and a single iteration.
+
+# Usage
+@code
+MocoInverseOnline online;
+online.setModel(ModelProcessor("subject.osim") |
+        ModOpReplaceMusclesWithDeGrooteFregly2016() |
+        ModOpIgnoreTendonCompliance() |
+        ModOpAddReserves(1.0) |
+        ModOpAddExternalLoads("external_loads.xml"));
+online.initialize();
+while (streaming) {
+    const MocoInverseOnlineFrame& frame = online.solveFrame(time, q, u, udot);
+}
+@endcode
+
+The vectors q, u, and udot are ordered as in SimTK::State::getQ(); see
+Model::getCoordinatesInMultibodyTreeOrder(). The kinematics should satisfy
+the model's kinematic constraints; forces from the kinematic constraints are
+determined by the solution. */
+class OSIMMOCO_API MocoInverseOnline : public Object {
+    OpenSim_DECLARE_CONCRETE_OBJECT(MocoInverseOnline, Object);
+
+public:
+    OpenSim_DECLARE_PROPERTY(
+            model, ModelProcessor, "The musculoskeletal model to use.");
+
+    OpenSim_DECLARE_PROPERTY(reserves_weight, double,
+            "The weight applied to the controls whose name includes "
+            "'/reserve_'. This can be used with "
+            "the model operator ModOpAddReserves, which names each appended "
+            "actuator in this format. Default weight: 1.");
+
+    OpenSim_DECLARE_PROPERTY(enforce_activation_dynamics, bool,
+            "Bound the change in muscle activation between consecutive frames "
+            "by the muscles' activation dynamics (default: true).");
+
+    OpenSim_DECLARE_PROPERTY(time_budget, double,
+            "Clock time (seconds) after which the iterations for a frame stop "
+            "(default: 0.005).");
+
+    OpenSim_DECLARE_PROPERTY(max_iterations, int,
+            "Maximum number of active-set iterations per frame "
+            "(default: 100).");
+
+    OpenSim_DECLARE_PROPERTY(convergence_tolerance, double,
+            "Tolerance on bound violations and multiplier signs "
+            "(default: 1e-8).");
+
+    MocoInverseOnline();
+    MocoInverseOnline(const MocoInverseOnline&);
+    MocoInverseOnline& operator=(const MocoInverseOnline&);
+    ~MocoInverseOnline() override;
+
+    void setModel(ModelProcessor model) { set_model(std::move(model)); }
+
+    /// Process the model and prepare to solve frames. This must be called
+    /// before solveFrame() and again after editing the model or
+    /// reserves_weight properties; the other properties take effect in the
+    /// next call to solveFrame().
+    void initialize();
+
+    /// The model processed by initialize().
+    const Model& getModel() const;
+
+    /// The paths of the actuators whose activations and controls are solved
+    /// for, in the order used by MocoInverseOnlineFrame.
+    const std::vector<std::string>& getActuatorPaths() const;
+
+    /// Solve for the activations and controls at the given time. The
+    /// externalBodyForces, if provided, are added to the forces from the
+    /// model (e.g., from streaming force plates); they are indexed by
+    /// SimTK::MobilizedBodyIndex and expressed in ground, as in
+    /// SimTK::MultibodySystem::getRigidBodyForces(). The returned reference is
+    /// valid until the next call to solveFrame().
+    const MocoInverseOnlineFrame& solveFrame(double time,
+            const SimTK::Vector& q, const SimTK::Vector& u,
+            const SimTK::Vector& udot,
+            const SimTK::Vector_<SimTK::SpatialVec>& externalBodyForces =
+                    SimTK::Vector_<SimTK::SpatialVec>());
+
+    /// Forget the previous frame, so that the next frame is not coupled to it
+    /// through activation dynamics or warm-started from it.
+    void reset();
+
+private:
+    void constructProperties();
+    struct Workspace;
+    SimTK::ResetOnCopy<std::unique_ptr<Workspace>> m_workspace;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MOCOINVERSEONLINE_H
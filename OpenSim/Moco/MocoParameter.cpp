@@ -17,8 +17,13 @@
  * -------------------------------------------------------------------------- */
 
 #include "MocoParameter.h"
+#include "MocoScaleFactor.h"
 #include "MocoUtilities.h"
+#include <OpenSim/Actuators/DeGrooteFregly2016Muscle.h>
 #include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/SmoothSphereHalfSpaceForce.h>
+
+#include <set>
 
 using namespace OpenSim;
 
@@ -126,6 +131,72 @@ void MocoParameter::initializeOnModel(Model& model) const {
         }
 
         m_property_refs.emplace_back(ap);
+        m_component_refs.emplace_back(&component);
+        m_system_updates.push_back(
+                getSystemUpdate(component, get_property_name()));
+    }
+}
+
+MocoParameter::SystemUpdate MocoParameter::getSystemUpdate(
+        const Component& component, const std::string& propertyName) {
+    if (const auto* body = dynamic_cast<const Body*>(&component)) {
+        if (propertyName == "mass" || propertyName == "mass_center" ||
+                propertyName == "inertia") {
+            if (body->canUpdateMassPropertiesInSystem()) {
+                return SystemUpdate_BodyMassProperties;
+            }
+        }
+    } else if (dynamic_cast<const DeGrooteFregly2016Muscle*>(&component)) {
+        // initializeOnModel() only accepts double, Vec3 and Vec6 properties,
+        // and all such properties of this muscle are scalar properties that
+        // do not affect its state variables.
+        return SystemUpdate_MuscleDerivedQuantities;
+    } else if (dynamic_cast<const SmoothSphereHalfSpaceForce*>(&component)) {
+        static const std::set<std::string> contactParameters{"stiffness",
+                "dissipation", "static_friction", "dynamic_friction",
+                "viscous_friction", "transition_velocity",
+                "constant_contact_force", "hertz_smoothing",
+                "hunt_crossley_smoothing"};
+        if (contactParameters.count(propertyName)) {
+            return SystemUpdate_ContactParameters;
+        }
+    } else if (dynamic_cast<const MocoScaleFactor*>(&component)) {
+        // The scale factor is read from the property whenever it is used.
+        if (propertyName == "scale_factor") return SystemUpdate_None;
+    }
+    return SystemUpdate_Unsupported;
+}
+
+bool MocoParameter::canApplyParameterToSystem() const {
+    for (const auto& update : m_system_updates) {
+        if (update == SystemUpdate_Unsupported) return false;
+    }
+    return true;
+}
+
+void MocoParameter::applyParameterToSystem() const {
+    for (int i = 0; i < (int)m_component_refs.size(); ++i) {
+        Component& component = *m_component_refs[i];
+        switch (m_system_updates[i]) {
+        case SystemUpdate_None:
+            break;
+        case SystemUpdate_BodyMassProperties:
+            static_cast<Body&>(component).updateMassPropertiesInSystem();
+            break;
+        case SystemUpdate_MuscleDerivedQuantities:
+            static_cast<DeGrooteFregly2016Muscle&>(component)
+                    .updateDerivedQuantitiesFromProperties();
+            break;
+        case SystemUpdate_ContactParameters:
+            static_cast<SmoothSphereHalfSpaceForce&>(component)
+                    .updateContactParametersInSystem();
+            break;
+        default:
+            OPENSIM_THROW_FRMOBJ(Exception,
+                    "Property '{}' of component '{}' cannot be applied "
+                    "without calling initSystem().",
+                    get_property_name(), component.getAbsolutePathString());
+        }
     }
 }
 
@@ -26,6 +26,7 @@
 
 namespace OpenSim {
 
+class Component;
 class Model;
 
 /** A MocoParameter allows you to optimize property values in an OpenSim Model.
@@ -88,6 +89,23 @@ std::vector<std::string> componentPaths = {
 MocoParameter y_com("y_com", componentPaths, "mass_center",
         MocoBounds(-0.05, 0.05), propertyElt);
 @endcode
+@par Updating parameters without initSystem()
+Most parameters require Model::initSystem() to take effect, which is expensive
+when it must be done for every evaluation of the optimal control problem
+(see MocoCasADiSolver's `parameters_require_initsystem`). The following
+property kinds can instead be pushed into the existing System, after which the
+solver only needs Model::initializeState(), which keeps the System's topology:
+ - Body: `mass`, `mass_center`, `inertia` (unless the Body was split to break
+   a kinematic loop).
+ - DeGrooteFregly2016Muscle: any scalar property.
+ - SmoothSphereHalfSpaceForce: `stiffness`, `dissipation`, `static_friction`,
+   `dynamic_friction`, `viscous_friction`, `transition_velocity`,
+   `constant_contact_force`, `hertz_smoothing`, `hunt_crossley_smoothing`.
+ - MocoScaleFactor: `scale_factor`.
+
+If any parameter in a problem uses a different property, solvers fall back to
+Model::initSystem().
+
 @par For developers
 Every time the problem is solved, a copy of this parameter is used.
 An individual instance of a parameter is only ever used in a single problem.
@@ -154,6 +172,16 @@ public:
     /** Set the value of the stored model properties, which may include
     properties from multiple models. */
     void applyParameterToModelProperties(const double& value) const;
+    /** Whether the stored model properties can be pushed into the models'
+    existing Systems with applyParameterToSystem() (see the class description
+    for the supported property kinds). */
+    bool canApplyParameterToSystem() const;
+    /** Push the current values of the stored model properties into the
+    existing Systems of the models on which this parameter was initialized,
+    without rebuilding the Systems. Model::initializeState() must be called
+    on each model afterwards for the values to take effect.
+    @precondition canApplyParameterToSystem() is true. */
+    void applyParameterToSystem() const;
 
     /** Print the name, property name, component paths, property element (if it
     exists), and bounds for this parameter. */
@@ -171,6 +199,19 @@ private:
         "model properties, the index of the element to be optimized.");
 
     mutable std::vector<SimTK::ReferencePtr<AbstractProperty>> m_property_refs;
+    // The component that owns each entry of m_property_refs, and how a new
+    // value for that property is pushed into the component's System.
+    mutable std::vector<SimTK::ReferencePtr<Component>> m_component_refs;
+    enum SystemUpdate {
+        SystemUpdate_Unsupported,
+        SystemUpdate_None,
+        SystemUpdate_BodyMassProperties,
+        SystemUpdate_MuscleDerivedQuantities,
+        SystemUpdate_ContactParameters
+    };
+    mutable std::vector<SystemUpdate> m_system_updates;
+    static SystemUpdate getSystemUpdate(
+            const Component& component, const std::string& propertyName);
     enum DataType {
         Type_double,
         Type_Vec3,
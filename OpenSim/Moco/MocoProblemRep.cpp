@@ -545,6 +545,13 @@ void MocoProblemRep::initialize() {
                 m_model_disabled_constraints);
         ++iparam;
     }
+    m_parametersApplyToSystem = true;
+    for (const auto& param : m_parameters) {
+        if (!param->canApplyParameterToSystem()) {
+            m_parametersApplyToSystem = false;
+            break;
+        }
+    }
 
     // Goals.
     // ------
@@ -788,9 +795,25 @@ void MocoProblemRep::applyParametersToModelProperties(
     if (initSystemAndDisableConstraints) {
         // TODO: Avoid these const_casts.
 
+        // If possible, push the new property values into the existing
+        // Systems and only re-create the default state, rather than
+        // rebuilding the Systems from scratch.
+        if (m_parametersApplyToSystem) {
+            for (const auto& param : m_parameters) {
+                param->applyParameterToSystem();
+            }
+        }
+        const auto initialize = [this](const Model& model) -> SimTK::State& {
+            Model& mutableModel = const_cast<Model&>(model);
+            if (m_parametersApplyToSystem) {
+                return mutableModel.initializeState();
+            }
+            return mutableModel.initSystem();
+        };
+
         // Model base.
         // -----------
-        const_cast<Model&>(m_model_base).initSystem();
+        initialize(m_model_base);
         // The PrescribedMotion is disabled by default in the model so that,
         // if there are constraints, the AssemblySolver does not complain about
         // having 0 parameters with which to satisfy the constraints. After
@@ -806,7 +829,7 @@ void MocoProblemRep::applyParametersToModelProperties(
                 const_cast<Model&>(m_model_disabled_constraints);
 
         m_state_disabled_constraints[0] =
-                m_model_disabled_constraints_const_cast.initSystem();
+                initialize(m_model_disabled_constraints);
         m_state_disabled_constraints[1] = m_state_disabled_constraints[0];
         // See comment above for m_position_motion_base.
         if (m_position_motion_disabled_constraints) {
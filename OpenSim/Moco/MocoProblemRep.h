@@ -30,6 +30,7 @@
 namespace OpenSim {
 
 class MocoProblem;
+class MocoSolver;
 class DiscreteController;
 class DiscreteForces;
 class PositionMotion;
@@ -299,7 +300,10 @@ public:
     /// method in order for provided parameter values to be applied to the
     /// model. You can pass `true` to have initSystem() called for you, and to
     /// also re-disable any constraints re-enabled by the initSystem() call
-    /// (see getModelDisabledConstraints()).
+    /// (see getModelDisabledConstraints()). If every parameter supports it
+    /// (see MocoParameter::canApplyParameterToSystem()), the new values are
+    /// instead pushed into the models' existing Systems and only
+    /// Model::initializeState() is invoked, which is much cheaper.
     void applyParametersToModelProperties(const SimTK::Vector& parameterValues,
             bool initSystemAndDisableConstraints = false) const;
 
@@ -328,6 +332,12 @@ private:
 
     void initialize();
 
+    /// Point this rep at a problem with the same content as the one from
+    /// which it was initialized, without initializing it again. This is used
+    /// by MocoSolver's pool of MocoProblemRep%s.
+    void setProblem(const MocoProblem& problem) { m_problem = &problem; }
+    friend MocoSolver;
+
     /// Get a list of reference pointers to all outputs whose names (not paths)
     /// match a substring defined by a provided regex string pattern. The regex
     /// string pattern could be the full name of the output. Only Output%s that
@@ -397,6 +407,9 @@ private:
     std::unordered_map<std::string, MocoVariableInfo> m_control_infos;
 
     std::vector<std::unique_ptr<MocoParameter>> m_parameters;
+    // Whether all parameters can be applied to the existing Systems, so that
+    // Model::initializeState() can be used instead of Model::initSystem().
+    bool m_parametersApplyToSystem = false;
     std::vector<std::unique_ptr<MocoGoal>> m_costs;
     std::vector<std::unique_ptr<MocoGoal>> m_endpoint_constraints;
     std::vector<std::unique_ptr<MocoPathConstraint>> m_path_constraints;
@@ -19,10 +19,57 @@
 
 #include "MocoProblem.h"
 
+#include <OpenSim/Common/CommonUtilities.h>
+#include <OpenSim/Common/IO.h>
+#include <OpenSim/Simulation/TableProcessor.h>
 #include <OpenSim/Simulation/Manager/Manager.h>
 
+#include <mutex>
+#include <unordered_map>
+
 using namespace OpenSim;
 
+namespace {
+struct ProblemRepPool {
+    std::mutex mutex;
+    bool enabled = false;
+    std::unordered_multimap<std::uint64_t, std::unique_ptr<MocoProblemRep>>
+            reps;
+    /// The key of each library filled while the pool was enabled.
+    std::unordered_map<const ThreadsafeJar<const MocoProblemRep>*,
+            std::uint64_t>
+            keysOfJars;
+};
+ProblemRepPool& getProblemRepPool() {
+    static ProblemRepPool pool;
+    return pool;
+}
+} // anonymous namespace
+
+void MocoSolver::setProblemRepPoolEnabled(bool enabled) {
+    auto& pool = getProblemRepPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.enabled = enabled;
+}
+
+bool MocoSolver::getProblemRepPoolEnabled() {
+    auto& pool = getProblemRepPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return pool.enabled;
+}
+
+int MocoSolver::getProblemRepPoolSize() {
+    auto& pool = getProblemRepPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return (int)pool.reps.size();
+}
+
+void MocoSolver::clearProblemRepPool() {
+    auto& pool = getProblemRepPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.reps.clear();
+}
+
 MocoTrajectory MocoSolver::createGuessTimeStepping() const {
     const auto& probrep = getProblemRep();
     const auto& initialTime = probrep.getTimeInitialBounds().getUpper();
@@ -101,11 +148,97 @@ void MocoSolver::setSolutionStats(MocoSolution& sol, bool success,
     sol.setObjectiveBreakdown(std::move(objectiveBreakdown));
 }
 
+namespace {
+/// Combine the content keys of all TableProcessors in the object's
+/// properties (e.g., the references of tracking goals), which may hold
+/// in-memory tables or read files that are not part of the serialized
+/// object. ModelProcessors are skipped, as they have their own key.
+void hashTableProcessors(const Object& object,
+        const std::string& directory, std::uint64_t& key) {
+    if (const auto* proc = dynamic_cast<const TableProcessor*>(&object)) {
+        if (proc->empty()) return;
+        const std::uint64_t tableKey = proc->computeContentKey(directory);
+        key = computeContentHash(&tableKey, sizeof(tableKey), key);
+        return;
+    }
+    if (dynamic_cast<const ModelProcessor*>(&object)) return;
+    for (int i = 0; i < object.getNumProperties(); ++i) {
+        const auto& prop = object.getPropertyByIndex(i);
+        if (!prop.isObjectProperty()) continue;
+        for (int j = 0; j < prop.size(); ++j) {
+            hashTableProcessors(prop.getValueAsObject(j), directory, key);
+        }
+    }
+}
+
+/// A key for everything that determines the MocoProblemReps created from
+/// the problem: the serialized problem, and the content of each phase's
+/// processed model and of each TableProcessor. The models and tables are
+/// processed relative to the current working directory (see
+/// MocoProblemRep::initialize()), so the paths are resolved against it.
+std::uint64_t computeProblemRepPoolKey(const MocoProblem& problem) {
+    const std::string directory = IO::getCwd();
+    std::uint64_t key = computeContentHash(problem.dump());
+    for (int iphase = 0; iphase < problem.getProperty_phases().size();
+            ++iphase) {
+        const auto& phase = problem.getPhase(iphase);
+        const std::uint64_t modelKey =
+                phase.getModelProcessor().computeContentKey(directory);
+        key = computeContentHash(&modelKey, sizeof(modelKey), key);
+        hashTableProcessors(phase, directory, key);
+    }
+    return key;
+}
+} // anonymous namespace
+
 std::unique_ptr<ThreadsafeJar<const MocoProblemRep>>
         MocoSolver::createProblemRepJar(int size) const {
     auto jar = OpenSim::make_unique<ThreadsafeJar<const MocoProblemRep>>();
-    for (int i = 0; i < size; ++i) {
+    int numReused = 0;
+    if (getProblemRepPoolEnabled() && getProblemRep().getNumParameters() == 0) {
+        const std::uint64_t key = computeProblemRepPoolKey(*m_problem);
+
+        auto& pool = getProblemRepPool();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        auto range = pool.reps.equal_range(key);
+        for (auto it = range.first; it != range.second && numReused < size;) {
+            it->second->setProblem(*m_problem);
+            jar->leave(std::move(it->second));
+            it = pool.reps.erase(it);
+            ++numReused;
+        }
+        pool.keysOfJars[jar.get()] = key;
+    } else {
+        // Forget the key of any library at the same address that was
+        // destroyed without being released.
+        auto& pool = getProblemRepPool();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.keysOfJars.erase(jar.get());
+    }
+    if (numReused) {
+        log_debug("Reusing {} of {} MocoProblemReps from the pool.", numReused,
+                size);
+    }
+    for (int i = numReused; i < size; ++i) {
         jar->leave(std::unique_ptr<MocoProblemRep>(m_problem->createRepHeap()));
     }
     return jar;
 }
+
+void MocoSolver::releaseProblemRepJar(
+        std::unique_ptr<ThreadsafeJar<const MocoProblemRep>> jar) {
+    if (!jar) return;
+    auto& pool = getProblemRepPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    const auto it = pool.keysOfJars.find(jar.get());
+    if (it == pool.keysOfJars.end()) return;
+    const std::uint64_t key = it->second;
+    pool.keysOfJars.erase(it);
+    if (!pool.enabled) return;
+    while (jar->size()) {
+        // The reps were created non-const.
+        std::unique_ptr<MocoProblemRep> rep(
+                const_cast<MocoProblemRep*>(jar->take().release()));
+        pool.reps.emplace(key, std::move(rep));
+    }
+}
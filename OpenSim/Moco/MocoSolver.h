@@ -75,6 +75,39 @@ public:
     /// @precondition You must have called resetProblem().
     MocoTrajectory createGuessTimeStepping() const;
 
+    /// @name Pool of MocoProblemRep%s
+    /// Solvers that evaluate the problem in parallel (e.g., MocoCasADiSolver)
+    /// create one MocoProblemRep per thread, and creating a MocoProblemRep
+    /// processes and initializes copies of the model. If the pool is enabled,
+    /// these MocoProblemReps are kept after each solve, keyed by a hash of the
+    /// serialized MocoProblem and the contents of any files its
+    /// ModelProcessors read, and later solves of a problem with the same key
+    /// (e.g., repeated solves in a grid search or in a batch of trials) reuse
+    /// them instead of creating new ones. Problems with parameters are not
+    /// pooled, since solving them edits the models.
+    ///
+    /// Enable the pool only if the problem is fully described by its
+    /// properties: components or goals with state that is not serialized
+    /// (e.g., defined in C++ and holding data set through their C++ API)
+    /// produce the same key as a problem without that state.
+    /// These settings apply to all solvers in this process.
+    /// @{
+    /// Enable or disable the pool (disabled by default). Disabling the pool
+    /// does not remove the MocoProblemReps it contains.
+    static void setProblemRepPoolEnabled(bool enabled);
+    static bool getProblemRepPoolEnabled();
+    /// The number of MocoProblemReps in the pool that are not in use.
+    static int getProblemRepPoolSize();
+    /// Remove all MocoProblemReps from the pool.
+    static void clearProblemRepPool();
+    /// Return the MocoProblemReps in a library created by
+    /// createProblemRepJar() to the pool, if the library was filled while
+    /// the pool was enabled and the pool is still enabled; otherwise, the
+    /// library is destroyed. All MocoProblemReps must be in the library.
+    static void releaseProblemRepJar(
+            std::unique_ptr<ThreadsafeJar<const MocoProblemRep>> jar);
+    /// @}
+
 protected:
 
     //OpenSim_DECLARE_LIST_PROPERTY(options, MocoSolverOption, "TODO");
@@ -94,6 +127,9 @@ protected:
     }
 
     /// Create a library of MocoProblemRep%s for use in parallelized code.
+    /// If the pool is enabled, the library is filled with MocoProblemReps from
+    /// the pool before creating new ones; pass the library to
+    /// releaseProblemRepJar() when done with it.
     // TODO SWIG ignore.
     std::unique_ptr<ThreadsafeJar<const MocoProblemRep>>
     createProblemRepJar(int size) const;
@@ -27,7 +27,9 @@
 #include "MocoUtilities.h"
 #include "MocoWeightSet.h"
 
+#include <OpenSim/Actuators/ModelOperators.h>
 #include <OpenSim/Common/STOFileAdapter.h>
+#include <OpenSim/Common/Stopwatch.h>
 #include <OpenSim/Common/GCVSpline.h>
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Simulation/MarkersReference.h>
@@ -46,19 +48,30 @@ void MocoTrack::constructProperties() {
     constructProperty_allow_unused_references(false);
     constructProperty_guess_file("");
     constructProperty_apply_tracked_states_to_guess(false);
+    constructProperty_coarse_mesh_warm_start(false);
+    constructProperty_coarse_mesh_interval_factor(4);
+    constructProperty_coarse_mesh_simplify_muscles(false);
     constructProperty_minimize_control_effort(true);
     constructProperty_control_effort_weight(0.001);
 }
 
-MocoStudy MocoTrack::initialize() {
+MocoStudy MocoTrack::initialize() { return initializeInternal(false); }
+
+MocoStudy MocoTrack::initializeInternal(bool coarse) {
 
     MocoStudy study;
-    study.setName(getName());
+    study.setName(coarse ? getName() + "_coarse" : getName());
     MocoProblem& problem = study.updProblem();
+    m_timeInfo = TimeInfo();
 
     // Modeling.
     // ---------
-    Model model = get_model().process(getDocumentDirectory());
+    ModelProcessor modelProcessor = get_model();
+    if (coarse && get_coarse_mesh_simplify_muscles()) {
+        modelProcessor.append(ModOpIgnoreTendonCompliance());
+        modelProcessor.append(ModOpIgnoreActivationDynamics());
+    }
+    Model model = modelProcessor.process(getDocumentDirectory());
     model.initSystem();
 
     // Goals.
@@ -104,7 +117,18 @@ MocoStudy MocoTrack::initialize() {
     // Configure solver.
     // -----------------
     MocoCasADiSolver& solver = study.initCasADiSolver();
-    solver.set_num_mesh_intervals(m_timeInfo.numMeshIntervals);
+    if (coarse) {
+        OPENSIM_THROW_IF_FRMOBJ(get_coarse_mesh_interval_factor() < 1,
+                Exception,
+                "Expected coarse_mesh_interval_factor to be at least 1, but "
+                "got {}.",
+                get_coarse_mesh_interval_factor());
+        solver.set_num_mesh_intervals(std::max(1,
+                m_timeInfo.numMeshIntervals /
+                        get_coarse_mesh_interval_factor()));
+    } else {
+        solver.set_num_mesh_intervals(m_timeInfo.numMeshIntervals);
+    }
     solver.set_multibody_dynamics_mode("explicit");
     solver.set_optim_convergence_tolerance(1e-2);
     solver.set_optim_constraint_tolerance(1e-2);
@@ -112,8 +136,11 @@ MocoStudy MocoTrack::initialize() {
 
     // Set the problem guess.
     // ----------------------
-    // If the user provided a guess file, use that guess in the solver.
-    if (!get_guess_file().empty()) {
+    // If the user provided a guess file, use that guess in the solver. The
+    // guess does not contain the states removed from the simplified coarse
+    // model, so it is not used for that model.
+    if (!get_guess_file().empty() &&
+            !(coarse && get_coarse_mesh_simplify_muscles())) {
         solver.setGuessFile(getFilePath(get_guess_file()));
     } else {
         solver.setGuess("bounds");
@@ -131,17 +158,103 @@ MocoStudy MocoTrack::initialize() {
 }
 
 MocoSolution MocoTrack::solveInternal(bool visualize) {
+    const Stopwatch stopwatch;
+
     // Generate the base MocoStudy.
     MocoStudy study = initialize();
 
+    // Warm start from the solution on a coarse mesh.
+    // ----------------------------------------------
+    if (get_coarse_mesh_warm_start()) { setGuessFromCoarseMesh(study); }
+
     // Solve!
     // ------
     MocoSolution solution = study.solve();
+    if (get_coarse_mesh_warm_start()) {
+        log_info("MocoTrack '{}': total time including the coarse mesh "
+                 "warm start: {}.",
+                getName(), stopwatch.getElapsedTimeFormatted());
+    }
     if (visualize) { study.visualize(solution); }
 
     return solution;
 }
 
+void MocoTrack::setGuessFromCoarseMesh(MocoStudy& study) {
+    const Stopwatch stopwatch;
+    MocoStudy coarseStudy = initializeInternal(true);
+    MocoSolution coarseSolution = coarseStudy.solve();
+    if (!coarseSolution.success()) {
+        log_warn("MocoTrack '{}': the coarse mesh problem did not converge; "
+                 "using its solution as the guess anyway.",
+                getName());
+        coarseSolution.unseal();
+    }
+
+    // Start from the default guess on the full mesh so that the guess contains
+    // every variable in the full problem, then overwrite the variables that
+    // the coarse problem solved for.
+    auto& solver = study.updSolver<MocoCasADiSolver>();
+    MocoTrajectory guess = solver.createGuess("bounds");
+    coarseSolution.resample(guess.getTime());
+
+    const auto contains = [](const std::vector<std::string>& names,
+                                  const std::string& name) {
+        return std::find(names.begin(), names.end(), name) != names.end();
+    };
+    const auto coarseStateNames = coarseSolution.getStateNames();
+    const auto coarseControlNames = coarseSolution.getControlNames();
+    for (const auto& name : guess.getStateNames()) {
+        if (contains(coarseStateNames, name)) {
+            guess.setState(name, coarseSolution.getState(name));
+            continue;
+        }
+        // Without activation dynamics, a muscle's control is its activation.
+        const std::string suffix = "/activation";
+        if (name.size() > suffix.size() &&
+                name.compare(name.size() - suffix.size(), suffix.size(),
+                        suffix) == 0) {
+            const auto controlName =
+                    name.substr(0, name.size() - suffix.size());
+            if (contains(coarseControlNames, controlName)) {
+                guess.setState(name, coarseSolution.getControl(controlName));
+            }
+        }
+    }
+    for (const auto& name : guess.getControlNames()) {
+        if (contains(coarseControlNames, name)) {
+            guess.setControl(name, coarseSolution.getControl(name));
+        }
+    }
+    const auto coarseMultiplierNames = coarseSolution.getMultiplierNames();
+    for (const auto& name : guess.getMultiplierNames()) {
+        if (contains(coarseMultiplierNames, name)) {
+            guess.setMultiplier(name, coarseSolution.getMultiplier(name));
+        }
+    }
+    const auto coarseDerivativeNames = coarseSolution.getDerivativeNames();
+    for (const auto& name : guess.getDerivativeNames()) {
+        if (contains(coarseDerivativeNames, name)) {
+            guess.setDerivative(name, coarseSolution.getDerivative(name));
+        }
+    }
+    const auto coarseParameterNames = coarseSolution.getParameterNames();
+    for (const auto& name : guess.getParameterNames()) {
+        if (contains(coarseParameterNames, name)) {
+            guess.setParameter(name, coarseSolution.getParameter(name));
+        }
+    }
+    solver.setGuess(guess);
+
+    log_info("MocoTrack '{}': solved the coarse mesh problem ({} mesh "
+             "intervals, {} iterations) in {}.",
+            getName(),
+            coarseStudy.updSolver<MocoCasADiSolver>()
+                    .get_num_mesh_intervals(),
+            coarseSolution.getNumIterations(),
+            stopwatch.getElapsedTimeFormatted());
+}
+
 TimeSeriesTable MocoTrack::configureStateTracking(
         MocoProblem& problem, Model& model) {
 
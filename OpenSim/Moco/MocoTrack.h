@@ -113,6 +113,20 @@ Default solver settings
 If you would like to use settings other than these defaults, see
 "Customizing a tracking problem" below.
 
+Coarse mesh warm start
+----------------------
+Starting from the default guess on a fine mesh can take many solver
+iterations. With the `coarse_mesh_warm_start` property enabled, solve() first
+solves the problem on a mesh that is `coarse_mesh_interval_factor` times
+coarser (optionally with simpler muscles; see
+`coarse_mesh_simplify_muscles`), interpolates the coarse solution onto the
+full mesh, and uses it as the guess for the full problem. Variables that do
+not exist in the simplified coarse problem (e.g., muscle activations when
+ignoring activation dynamics) are taken from the coarse problem's controls
+where possible, and otherwise from the midpoint of their bounds. The time
+spent in each solve is logged. Since a guess is created automatically, the
+warm start is not applied to the MocoStudy returned by initialize().
+
 Basic example
 -------------
 Construct a tracking problem by setting property values and calling solve():
@@ -226,6 +240,23 @@ public:
             "This will override any guess information provided via "
             "`guess_file`. Default: false.");
 
+    OpenSim_DECLARE_PROPERTY(coarse_mesh_warm_start, bool,
+            "Before solving, solve the problem on a coarser mesh and use that "
+            "solution (interpolated onto the full mesh) as the guess for "
+            "the full problem. This overrides the guess from `guess_file` and "
+            "`apply_tracked_states_to_guess`, which are used for the "
+            "coarse problem instead. Default: false.");
+
+    OpenSim_DECLARE_PROPERTY(coarse_mesh_interval_factor, int,
+            "The ratio of the coarse mesh interval to `mesh_interval` when "
+            "using `coarse_mesh_warm_start`. Default: 4.");
+
+    OpenSim_DECLARE_PROPERTY(coarse_mesh_simplify_muscles, bool,
+            "When using `coarse_mesh_warm_start`, ignore tendon compliance and "
+            "activation dynamics in the coarse problem (see "
+            "ModOpIgnoreTendonCompliance and ModOpIgnoreActivationDynamics). "
+            "Default: false.");
+
     OpenSim_DECLARE_PROPERTY(minimize_control_effort, bool,
             "Whether or not to minimize actuator control effort in the problem."
             "Default: true.");
@@ -265,7 +296,10 @@ public:
     }
 
     MocoStudy initialize();
-    /// Solve the MocoTrack problem and obtain the solution.
+    /// Solve the MocoTrack problem and obtain the solution. If
+    /// `coarse_mesh_warm_start` is enabled, this first solves the problem on
+    /// a coarse mesh to create the guess (see "Coarse mesh warm start"
+    /// above).
     MocoSolution solve() { return solveInternal(false); }
     /// Solve the MocoTrack problem, visualize the solution, then obtain the
     /// solution.
@@ -285,6 +319,12 @@ private:
     void applyStatesToGuess(
             const TimeSeriesTable& states, MocoTrajectory& guess) const;
 
+    // Create the MocoStudy, on the coarse mesh if `coarse` is true.
+    MocoStudy initializeInternal(bool coarse);
+    // Solve the problem on the coarse mesh and set the guess in the study's
+    // solver from the coarse solution.
+    void setGuessFromCoarseMesh(MocoStudy& study);
+
     MocoSolution solveInternal(bool visualize);
 };
 
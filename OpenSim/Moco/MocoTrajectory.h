@@ -1031,6 +1031,8 @@ private:
     double m_solverDuration = -1;
     // Allow solvers to set success, status, and construct a solution.
     friend class MocoSolver;
+    // Allow MocoInverse to stitch solutions from its time windows.
+    friend class MocoInverse;
 };
 
 } // namespace OpenSim
@@ -46,6 +46,7 @@
 #include "MocoGoal/MocoStepTimeAsymmetryGoal.h"
 #include "MocoGoal/MocoStepLengthAsymmetryGoal.h"
 #include "MocoInverse.h"
+#include "MocoInverseOnline.h"
 #include "MocoParameter.h"
 #include "MocoProblem.h"
 #include "MocoStudy.h"
@@ -97,6 +98,7 @@ OSIMMOCO_API void RegisterTypes_osimMoco() {
         Object::registerType(MocoStudy());
 
         Object::registerType(MocoInverse());
+        Object::registerType(MocoInverseOnline());
         Object::registerType(MocoTrack());
 
         Object::registerType(MocoTropterSolver());
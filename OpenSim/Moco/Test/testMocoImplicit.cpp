@@ -260,6 +260,68 @@ TEMPLATE_TEST_CASE("Combining implicit dynamics with kinematic constraints",
     }
 }
 
+TEST_CASE("Batched implicit multibody dynamics", "[implicit][casadi]") {
+    auto createStudy = [](bool withConstraint, int numMeshIntervals) {
+        MocoStudy study;
+        auto& prob = study.updProblem();
+        auto model = ModelFactory::createDoublePendulum();
+        if (withConstraint) {
+            auto* constraint = new CoordinateCouplerConstraint();
+            Array<std::string> names;
+            names.append("q0");
+            constraint->setIndependentCoordinateNames(names);
+            constraint->setDependentCoordinateName("q1");
+            LinearFunction func(1.0, 0.0);
+            constraint->setFunction(func);
+            model.addConstraint(constraint);
+        }
+        prob.setModelAsCopy(model);
+        prob.setTimeBounds(0, 1);
+        prob.setStateInfo("/jointset/j0/q0/value", {-10, 10}, 0, 0.5);
+        prob.setStateInfo("/jointset/j0/q0/speed", {-50, 50}, 0, 0);
+        prob.setStateInfo("/jointset/j1/q1/value", {-10, 10}, 0);
+        prob.setStateInfo("/jointset/j1/q1/speed", {-50, 50}, 0, 0);
+        prob.addGoal<MocoControlGoal>();
+        auto& solver = study.initCasADiSolver();
+        solver.set_multibody_dynamics_mode("implicit");
+        solver.set_num_mesh_intervals(numMeshIntervals);
+        solver.set_transcription_scheme("hermite-simpson");
+        solver.set_enforce_constraint_derivatives(withConstraint);
+        return study;
+    };
+
+    SECTION("Same solution as evaluating one point per call") {
+        // With 5 mesh intervals, neither the 6 mesh points nor the 5 mesh
+        // interval interior points are a multiple of the batch size.
+        MocoStudy study = createStudy(true, 5);
+        MocoSolution solution = study.solve();
+        auto& solver = study.updSolver<MocoCasADiSolver>();
+        solver.set_implicit_multibody_batch_size(4);
+        MocoSolution solutionBatch = study.solve();
+        CHECK(solution.success());
+        CHECK(solutionBatch.success());
+        CHECK(solutionBatch.compareContinuousVariablesRMS(solution) ==
+                Approx(0).margin(1e-4));
+        SimTK_TEST_EQ_TOL(solutionBatch.getStatesTrajectory().col(0),
+                solutionBatch.getStatesTrajectory().col(1), 1e-6);
+    }
+
+    SECTION("Same solution with a batch larger than the mesh") {
+        // Without kinematic constraints and without parallelization, all
+        // points are evaluated in a single, partially filled batch.
+        MocoStudy study = createStudy(false, 5);
+        auto& solver = study.updSolver<MocoCasADiSolver>();
+        solver.set_parallel(0);
+        MocoSolution solution = study.solve();
+        solver.set_implicit_multibody_batch_size(50);
+        MocoSolution solutionBatch = study.solve();
+        CHECK(solution.success());
+        CHECK(solutionBatch.success());
+        CHECK(solutionBatch.compareContinuousVariablesRMS(solution) ==
+                Approx(0).margin(1e-4));
+    }
+}
+
 SCENARIO("Using MocoTrajectory with the implicit dynamics mode",
         "[implicit][trajectory]") {
     GIVEN("MocoTrajectory with only derivatives") {
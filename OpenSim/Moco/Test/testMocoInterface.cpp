@@ -2060,6 +2060,62 @@ TEST_CASE("Objective breakdown", "[casadi]") {
     CHECK(solution.getObjectiveTerm("goal_b") == Approx(0.01 * 7.3));
 }
 
+TEST_CASE("MocoProblemRep pool", "[casadi]") {
+    MocoSolver::clearProblemRepPool();
+    MocoSolver::setProblemRepPoolEnabled(true);
+
+    MocoStudy study;
+    study.set_write_solution("false");
+    auto& problem = study.updProblem();
+    problem.setModel(createSlidingMassModel());
+    problem.setTimeBounds(0, 2);
+    problem.setStateInfo("/slider/position/value", {0, 1}, 0, 1);
+    problem.setStateInfo("/slider/position/speed", {-100, 100}, 0, 0);
+    problem.addGoal<MocoControlGoal>();
+    auto& solver = study.initCasADiSolver();
+    solver.set_num_mesh_intervals(10);
+    solver.set_parallel(2);
+
+    // The MocoProblemReps of the first solve are returned to the pool.
+    MocoSolution solution = study.solve();
+    REQUIRE(solution.success());
+    CHECK(MocoSolver::getProblemRepPoolSize() == 2);
+
+    // Solving the same problem again (or a copy of it) reuses them.
+    MocoSolution reused = study.solve();
+    CHECK(MocoSolver::getProblemRepPoolSize() == 2);
+    OpenSim_CHECK_MATRIX_ABSTOL(reused.getControlsTrajectory(),
+            solution.getControlsTrajectory(), 1e-10);
+    MocoStudy copy = study;
+    MocoSolution reusedByCopy = copy.solve();
+    CHECK(MocoSolver::getProblemRepPoolSize() == 2);
+    OpenSim_CHECK_MATRIX_ABSTOL(reusedByCopy.getControlsTrajectory(),
+            solution.getControlsTrajectory(), 1e-10);
+
+    // Editing the problem changes the key.
+    problem.setTimeBounds(0, 3);
+    study.solve();
+    CHECK(MocoSolver::getProblemRepPoolSize() == 4);
+
+    // In-memory reference tables are not serialized, but their content is
+    // part of the key.
+    TimeSeriesTable reference(std::vector<double>{0, 1.5, 3},
+            SimTK::Matrix(3, 1, 0.5), {"/slider/position/value"});
+    auto* tracking = problem.addGoal<MocoStateTrackingGoal>("tracking");
+    tracking->setReference(reference);
+    study.solve();
+    CHECK(MocoSolver::getProblemRepPoolSize() == 6);
+    reference.updMatrix().setTo(0.25);
+    tracking->setReference(reference);
+    study.solve();
+    CHECK(MocoSolver::getProblemRepPoolSize() == 8);
+
+    MocoSolver::clearProblemRepPool();
+    MocoSolver::setProblemRepPoolEnabled(false);
+    study.solve();
+    CHECK(MocoSolver::getProblemRepPoolSize() == 0);
+}
+
 TEST_CASE("generateAccelerationsFromXXX() does not overwrite existing "
           "non-accleration derivatives.") {
     int N = 20;
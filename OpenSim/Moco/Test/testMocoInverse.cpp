@@ -21,6 +21,8 @@
 #include <OpenSim/Moco/osimMoco.h>
 #include <OpenSim/Tools/AnalyzeTool.h>
 #include <OpenSim/Analyses/IMUDataReporter.h>
+#include <OpenSim/Common/GCVSplineSet.h>
+#include <OpenSim/Common/Stopwatch.h>
 
 #define CATCH_CONFIG_MAIN
 #include "Testing.h"
@@ -120,6 +122,55 @@ TEST_CASE("PrescribedKinematics direct collocation auxiliary dynamics",
             0.2 * SimTK::exp(solution.getTime()), 1e-4);
 }
 
+TEST_CASE("PositionMotion::createFromStatesTable()") {
+    // The direct path must match creating a StatesTrajectory and then a
+    // PositionMotion from it.
+    auto model = ModelFactory::createNLinkPendulum(3);
+    const int N = 200;
+    std::vector<double> time(N);
+    SimTK::Matrix data(N, 4);
+    for (int i = 0; i < N; ++i) {
+        time[i] = 0.01 * i;
+        data(i, 0) = 0.5 * std::sin(time[i]);
+        data(i, 1) = 0.3 * std::cos(2 * time[i]);
+        data(i, 2) = -0.2 * std::sin(3 * time[i]);
+        data(i, 3) = 1.0; // not a state variable.
+    }
+    TimeSeriesTable table(time, data,
+            {"/jointset/j0/q0/value", "/jointset/j1/q1/value",
+                    "/jointset/j2/q2/value", "/extra"});
+
+    auto compare = [&](Model& thisModel) {
+        thisModel.initSystem();
+        auto statesTraj = StatesTrajectory::createFromStatesTable(
+                thisModel, table, true, true, true);
+        auto expected = PositionMotion::createFromStatesTrajectory(
+                thisModel, statesTraj)->exportToTable(time);
+        Stopwatch watch;
+        auto actual = PositionMotion::createFromStatesTable(
+                thisModel, table, true, true, 2)->exportToTable(time);
+        log_info("createFromStatesTable(): {}",
+                watch.getElapsedTimeFormatted());
+        REQUIRE(actual.getColumnLabels() == expected.getColumnLabels());
+        OpenSim_CHECK_MATRIX_ABSTOL(
+                actual.getMatrix(), expected.getMatrix(), 1e-10);
+    };
+
+    SECTION("No constraints") { compare(model); }
+
+    SECTION("Locked coordinate requires assembly") {
+        model.updComponent<Coordinate>("/jointset/j1/q1")
+                .setDefaultLocked(true);
+        compare(model);
+    }
+
+    SECTION("Extra columns") {
+        model.initSystem();
+        CHECK_THROWS_AS(PositionMotion::createFromStatesTable(model, table),
+                StatesTrajectory::ExtraColumns);
+    }
+}
+
 TEST_CASE("MocoInverse Rajagopal2016, 18 muscles", "[casadi]") {
 
     MocoInverse inverse;
@@ -149,6 +200,7 @@ TEST_CASE("MocoInverse Rajagopal2016, 18 muscles", "[casadi]") {
         MocoInverseSolution inverseSolution = inverse.solve();
         MocoSolution solution = inverseSolution.getMocoSolution();
         //solution.write("testMocoInverse_subject_18musc_solution.sto");
+        CHECK(inverseSolution.getSetupDuration() > 0);
 
         MocoTrajectory std("std_testMocoInverse_subject_18musc_solution.sto");
         const auto expected = std.getControlsTrajectory();
@@ -178,6 +230,49 @@ TEST_CASE("MocoInverse Rajagopal2016, 18 muscles", "[casadi]") {
         }
     }
 
+    SECTION("Receding horizon") {
+        // Compare to the full-horizon solution.
+        MocoTrajectory std("std_testMocoInverse_subject_18musc_solution.sto");
+        inverse.set_window_duration(0.2);
+        inverse.set_window_overlap(0.1);
+        std::vector<MocoSolution> solutions;
+        for (bool continuity : {true, false}) {
+            inverse.set_window_enforce_continuity(continuity);
+            MocoInverseSolution inverseSolution = inverse.solve();
+            MocoSolution solution = inverseSolution.getMocoSolution();
+            solutions.push_back(solution);
+            REQUIRE(solution.success());
+            CHECK(solution.getInitialTime() == Approx(0.450));
+            CHECK(solution.getFinalTime() == Approx(1.0));
+            const double controlsRMS = std.compareContinuousVariablesRMS(
+                    solution, {{"controls", {}}});
+            const double statesRMS = std.compareContinuousVariablesRMS(
+                    solution, {{"states", {}}});
+            log_info("Receding horizon (continuity: {}): controls RMS error "
+                     "{}, states RMS error {}, solver duration {} s.",
+                    continuity, controlsRMS, statesRMS,
+                    solution.getSolverDuration());
+            CHECK(controlsRMS < 5e-2);
+            CHECK(statesRMS < 5e-2);
+            CHECK(inverseSolution.getOutputs().getNumRows() ==
+                    (size_t)solution.getNumTimes());
+        }
+        // The first window is the same problem in both modes, so its kept
+        // part (until the second window starts at 0.55 s) must be identical.
+        const auto& time = solutions[0].getTime();
+        int numRows = 0;
+        while (numRows < time.size() && time[numRows] < 0.55) ++numRows;
+        REQUIRE(numRows > 0);
+        for (int i = 0; i < numRows; ++i) {
+            CAPTURE(i);
+            CHECK(solutions[1].getTime()[i] == time[i]);
+            CHECK(solutions[1].getStatesTrajectory()[i] ==
+                    solutions[0].getStatesTrajectory()[i]);
+            CHECK(solutions[1].getControlsTrajectory()[i] ==
+                    solutions[0].getControlsTrajectory()[i]);
+        }
+    }
+
     SECTION("With a MocoControlBoundConstraint") {
         MocoStudy study = inverse.initialize();
         auto& problem = study.updProblem();
@@ -205,6 +300,132 @@ TEST_CASE("MocoInverse Rajagopal2016, 18 muscles", "[casadi]") {
 
     }
 }
+
+TEST_CASE("MocoInverseOnline Rajagopal2016, 18 muscles") {
+    MocoInverseOnline online;
+    online.setModel(
+            ModelProcessor("subject_walk_armless_18musc.osim") |
+            ModOpReplaceJointsWithWelds(
+                    {"subtalar_r", "subtalar_l", "mtp_r", "mtp_l"}) |
+            ModOpReplaceMusclesWithDeGrooteFregly2016() |
+            ModOpIgnorePassiveFiberForcesDGF() |
+            ModOpIgnoreTendonCompliance() |
+            ModOpAddReserves(1.0) |
+            ModOpAddExternalLoads("subject_walk_armless_external_loads.xml"));
+    // Solve each frame to convergence for the correctness checks.
+    online.set_time_budget(1.0);
+    online.initialize();
+    const Model& model = online.getModel();
+    const auto& actuPaths = online.getActuatorPaths();
+    const int na = (int)actuPaths.size();
+
+    // Stream the frames of the filtered kinematics between 0.45 and 1.0 s.
+    TimeSeriesTable kinematics =
+            (TableProcessor("subject_walk_armless_coordinates.mot") |
+                    TabOpLowPassFilter(6))
+                    .processAndConvertToRadians(model);
+    GCVSplineSet splines(kinematics);
+    const auto coords = model.getCoordinatesInMultibodyTreeOrder();
+    const int nu = (int)coords.size();
+    SimTK::Vector q(nu), u(nu), udot(nu);
+    std::vector<double> times;
+    for (const auto& time : kinematics.getIndependentColumn()) {
+        if (time >= 0.45 && time <= 1.0) times.push_back(time);
+    }
+    REQUIRE(times.size() > 50);
+    const auto setKinematics = [&](double time) {
+        const SimTK::Vector x(1, time);
+        for (int i = 0; i < nu; ++i) {
+            const auto& spline = splines.get(coords[i]->getName());
+            q[i] = spline.calcValue(x);
+            u[i] = spline.calcDerivative({0}, x);
+            udot[i] = spline.calcDerivative({0, 0}, x);
+        }
+    };
+
+    SECTION("Solution") {
+        SimTK::Vector previous;
+        double previousTime = SimTK::NaN;
+        int numIterations = 0;
+        for (const auto& time : times) {
+            setKinematics(time);
+            const auto& frame = online.solveFrame(time, q, u, udot);
+            REQUIRE(frame.activations.size() == na);
+            CHECK(frame.success);
+            // The reserves make every frame feasible.
+            CHECK(frame.constraintViolation < 1e-6);
+            numIterations += frame.numIterations;
+            for (int j = 0; j < na; ++j) {
+                const auto* muscle =
+                        dynamic_cast<const DeGrooteFregly2016Muscle*>(
+                                &model.getComponent(actuPaths[j]));
+                if (!muscle) continue;
+                const double a = frame.activations[j];
+                CHECK(a >= muscle->getMinControl());
+                CHECK(a <= muscle->getMaxControl());
+                CHECK(frame.controls[j] >= muscle->getMinControl());
+                CHECK(frame.controls[j] <= muscle->getMaxControl());
+                if (previous.size()) {
+                    // The change in activation respects activation dynamics.
+                    const double a0 = previous[j];
+                    const double dt = time - previousTime;
+                    const double factor = 0.5 + 1.5 * a0;
+                    const double tauAct =
+                            muscle->get_activation_time_constant() * factor;
+                    const double tauDeact =
+                            muscle->get_deactivation_time_constant() / factor;
+                    CHECK(a <= a0 + dt * (1 - a0) / tauAct + 1e-10);
+                    CHECK(a >= a0 - dt * a0 / tauDeact - 1e-10);
+                }
+            }
+            previous = frame.activations;
+            previousTime = time;
+        }
+        log_info("MocoInverseOnline: {} frames, {:.2f} active-set iterations "
+                 "per frame.",
+                times.size(), (double)numIterations / (double)times.size());
+    }
+
+    SECTION("Latency") {
+        online.set_time_budget(0.002);
+        std::vector<double> durations;
+        for (const auto& time : times) {
+            setKinematics(time);
+            const auto& frame = online.solveFrame(time, q, u, udot);
+            durations.push_back(frame.solverDuration);
+            for (int j = 0; j < na; ++j) {
+                CHECK(SimTK::isFinite(frame.activations[j]));
+            }
+        }
+        std::sort(durations.begin(), durations.end());
+        const auto percentile = [&](double p) {
+            return durations[std::min(durations.size() - 1,
+                    (size_t)(p * (double)durations.size()))];
+        };
+        log_info("MocoInverseOnline latency (ms): 50th percentile {:.3f}, "
+                 "90th percentile {:.3f}, 99th percentile {:.3f}, "
+                 "max {:.3f}.",
+                1e3 * percentile(0.5), 1e3 * percentile(0.9),
+                1e3 * percentile(0.99), 1e3 * durations.back());
+    }
+
+    SECTION("Time budget") {
+        // An exhausted budget stops after a single iteration, and the
+        // activations are still within their bounds.
+        online.set_time_budget(1e-12);
+        for (const auto& time : times) {
+            setKinematics(time);
+            const auto& frame = online.solveFrame(time, q, u, udot);
+            CHECK(frame.numIterations == 1);
+            for (int j = 0; j < na; ++j) {
+                const auto& actu = model.getComponent<Actuator>(actuPaths[j]);
+                CHECK(frame.activations[j] >= actu.getMinControl());
+                CHECK(frame.activations[j] <= actu.getMaxControl());
+            }
+        }
+    }
+}
+
 // Next test_case fails on linux while parsing .sto file, disabling for now 
 #ifdef _WIN32
 TEST_CASE("Test IMUDataReporter for gait") {
@@ -16,6 +16,7 @@
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
 
+#include <OpenSim/Common/Stopwatch.h>
 #include <OpenSim/Moco/osimMoco.h>
 
 #define CATCH_CONFIG_MAIN
@@ -611,3 +612,110 @@ TEST_CASE("Bhargava2004SmoothedMuscleMetabolics basics") {
 
     }
 }
+
+TEST_CASE("Bhargava2004SmoothedMuscleMetabolics per-muscle rates") {
+
+    // Several muscles acting on separate bodies, added to the metabolics
+    // model in an order that differs from the order of their paths, and one
+    // muscle that does not apply force.
+    Model model;
+    model.setName("muscles");
+    const int numMuscles = 6;
+    for (int i = 0; i < numMuscles; ++i) {
+        const std::string suffix = std::to_string(i);
+        auto* body = new Body("body" + suffix, 0.5, SimTK::Vec3(0),
+                SimTK::Inertia(0));
+        model.addComponent(body);
+        auto* joint = new SliderJoint("joint" + suffix, model.getGround(),
+                *body);
+        joint->updCoordinate(SliderJoint::Coord::TranslationX).setName(
+                "x" + suffix);
+        model.addComponent(joint);
+        auto* muscle = new DeGrooteFregly2016Muscle();
+        muscle->setName("muscle" + suffix);
+        muscle->set_max_isometric_force(100.0 * (i + 1));
+        muscle->addNewPathPoint("origin", model.updGround(), SimTK::Vec3(0));
+        muscle->addNewPathPoint("insertion", *body, SimTK::Vec3(0));
+        model.addComponent(muscle);
+    }
+    model.updComponent<Muscle>("muscle2").set_appliesForce(false);
+
+    auto* allMetabolics = new Bhargava2004SmoothedMuscleMetabolics();
+    allMetabolics->setName("all_metabolics");
+    allMetabolics->set_use_smoothing(true);
+    for (int i = numMuscles - 1; i >= 0; --i) {
+        const std::string suffix = std::to_string(i);
+        allMetabolics->addMuscle("muscle" + suffix,
+                model.getComponent<Muscle>("muscle" + suffix),
+                0.1 * (i + 1), 0.25e6);
+    }
+    model.addComponent(allMetabolics);
+
+    // One metabolics model per muscle, to compare against.
+    for (int i = 0; i < numMuscles; ++i) {
+        const std::string suffix = std::to_string(i);
+        auto* metabolics = new Bhargava2004SmoothedMuscleMetabolics();
+        metabolics->setName("metabolics" + suffix);
+        metabolics->set_use_smoothing(true);
+        metabolics->addMuscle("muscle" + suffix,
+                model.getComponent<Muscle>("muscle" + suffix),
+                0.1 * (i + 1), 0.25e6);
+        model.addComponent(metabolics);
+    }
+    model.finalizeConnections();
+
+    SimTK::State state = model.initSystem();
+    SimTK::Vector& controls(model.updControls(state));
+    for (int i = 0; i < numMuscles; ++i) {
+        const std::string suffix = std::to_string(i);
+        const auto& muscle =
+                model.getComponent<DeGrooteFregly2016Muscle>("muscle" + suffix);
+        const auto& coord = model.getCoordinateSet().get("x" + suffix);
+        coord.setValue(state, muscle.get_optimal_fiber_length() +
+                muscle.get_tendon_slack_length() + 0.01 * i);
+        coord.setSpeedValue(state, 0.05 * (i - 2));
+        muscle.setActivation(state, 0.1 + 0.1 * i);
+        muscle.setControls(SimTK::Vector(1, 0.15 + 0.1 * i), controls);
+    }
+    model.setControls(state, controls);
+    model.realizeVelocity(state);
+    model.equilibrateMuscles(state);
+    model.realizeDynamics(state);
+
+    const auto& all =
+            model.getComponent<Bhargava2004SmoothedMuscleMetabolics>(
+                    "all_metabolics");
+    double sumOfIndividualRates = 0;
+    for (int i = 0; i < numMuscles; ++i) {
+        const std::string suffix = std::to_string(i);
+        if (i == 2) continue;
+        const auto& single =
+                model.getComponent<Bhargava2004SmoothedMuscleMetabolics>(
+                        "metabolics" + suffix);
+        const std::string path = "/muscle" + suffix;
+        const double rate = single.getMuscleMetabolicRate(state, path);
+        CHECK(all.getMuscleMetabolicRate(state, path) == Approx(rate));
+        sumOfIndividualRates += rate;
+    }
+    CHECK_THROWS(all.getMuscleMetabolicRate(state, "/muscle2"));
+    const double basalRate = all.get_basal_coefficient() *
+            pow(model.getMatterSubsystem().calcSystemMass(state),
+                    all.get_basal_exponent());
+    CHECK(all.getTotalMetabolicRate(state) ==
+            Approx(sumOfIndividualRates + basalRate));
+
+    // Time repeated evaluations of the total metabolic rate, as performed
+    // by a MocoOutputGoal on total_metabolic_rate in a MocoTrack problem.
+    const int numEvaluations = 10000;
+    double total = 0;
+    Stopwatch watch;
+    for (int k = 0; k < numEvaluations; ++k) {
+        state.setTime(1e-6 * k);
+        model.realizeDynamics(state);
+        total += all.getTotalMetabolicRate(state);
+    }
+    log_info("Evaluated total_metabolic_rate for {} muscles {} times in {}.",
+            numMuscles - 1, numEvaluations, watch.getElapsedTimeFormatted());
+    CHECK(total / numEvaluations ==
+            Approx(all.getTotalMetabolicRate(state)));
+}
@@ -19,7 +19,9 @@
 #define CATCH_CONFIG_MAIN
 #include "Testing.h"
 
+#include <OpenSim/Actuators/DeGrooteFregly2016Muscle.h>
 #include <OpenSim/Actuators/SpringGeneralizedForce.h>
+#include <OpenSim/Common/Stopwatch.h>
 #include <OpenSim/Moco/osimMoco.h>
 #include <OpenSim/Simulation/SimbodyEngine/PinJoint.h>
 #include <OpenSim/Simulation/SimbodyEngine/SliderJoint.h>
@@ -257,3 +259,134 @@ TEMPLATE_TEST_CASE("See-saw center of mass", "",
 
     CHECK(sol_xCOM == Approx(xCOM).epsilon(0.003));
 }
+
+TEST_CASE("Parameters applied without initSystem") {
+    const int numEvaluations = 100;
+
+    // Body mass can be pushed into the existing System.
+    MocoProblem massProblem;
+    massProblem.setModel(createOscillatorModel());
+    massProblem.setTimeBounds(0, FINAL_TIME);
+    massProblem.addParameter("oscillator_mass", "body", "mass",
+            MocoBounds(0, 10));
+    const MocoProblemRep massRep = massProblem.createRep();
+
+    // SpringGeneralizedForce stiffness is not a supported property kind, so
+    // applying it requires initSystem().
+    MocoProblem stiffnessProblem;
+    stiffnessProblem.setModel(createOscillatorModel());
+    stiffnessProblem.setTimeBounds(0, FINAL_TIME);
+    stiffnessProblem.addParameter("stiffness",
+            "springgeneralizedforce", "stiffness",
+            MocoBounds(0, 200));
+    const MocoProblemRep stiffnessRep = stiffnessProblem.createRep();
+
+    SECTION("New values take effect") {
+        massRep.applyParametersToModelProperties(SimTK::Vector(1, 7.0), true);
+        const auto& model = massRep.getModelDisabledConstraints();
+        auto& state = massRep.updStateDisabledConstraints();
+        CHECK(model.getTotalMass(state) == Approx(7.0));
+        CHECK(model.getMatterSubsystem().calcSystemMass(state) ==
+                Approx(7.0));
+        CHECK(massRep.getModelBase().getTotalMass(
+                massRep.getModelBase().getWorkingState()) == Approx(7.0));
+
+        // The dynamics reflect the new mass.
+        model.getCoordinateSet().get("position").setValue(state, 0.5);
+        model.realizeAcceleration(state);
+        CHECK(state.getUDot()[0] == Approx(-STIFFNESS * 0.5 / 7.0));
+    }
+
+    SECTION("Timing") {
+        Stopwatch watch;
+        for (int i = 0; i < numEvaluations; ++i) {
+            massRep.applyParametersToModelProperties(
+                    SimTK::Vector(1, 4.0 + 0.01 * i), true);
+        }
+        const long long inPlaceTime = watch.getElapsedTimeInNs();
+        watch.reset();
+        for (int i = 0; i < numEvaluations; ++i) {
+            stiffnessRep.applyParametersToModelProperties(
+                    SimTK::Vector(1, 90.0 + 0.1 * i), true);
+        }
+        const long long initSystemTime = watch.getElapsedTimeInNs();
+        log_info("Applied parameters {} times: {} in place, {} with "
+                 "initSystem().", numEvaluations,
+                Stopwatch::formatNs(inPlaceTime),
+                Stopwatch::formatNs(initSystemTime));
+    }
+}
+
+namespace {
+std::unique_ptr<Model> createMuscleModel() {
+    auto model = make_unique<Model>();
+    model->setName("muscle");
+    model->set_gravity(SimTK::Vec3(9.81, 0, 0));
+    auto* body = new Body("body", 0.5, SimTK::Vec3(0), SimTK::Inertia(0));
+    model->addComponent(body);
+    auto* joint = new SliderJoint("joint", model->getGround(), *body);
+    joint->updCoordinate().setName("height");
+    model->addComponent(joint);
+    auto* muscle = new DeGrooteFregly2016Muscle();
+    muscle->setName("muscle");
+    muscle->set_max_isometric_force(30.0);
+    muscle->set_optimal_fiber_length(0.10);
+    muscle->set_tendon_slack_length(0.05);
+    muscle->set_pennation_angle_at_optimal(0.1);
+    muscle->set_ignore_tendon_compliance(true);
+    muscle->addNewPathPoint("origin", model->updGround(), SimTK::Vec3(0));
+    muscle->addNewPathPoint("insertion", *body, SimTK::Vec3(0));
+    model->addForce(muscle);
+    model->finalizeConnections();
+    return model;
+}
+
+double calcTendonForce(const Model& model, SimTK::State& state) {
+    model.getCoordinateSet().get("height").setValue(state, 0.16);
+    const auto& muscle = model.getComponent<Muscle>("/forceset/muscle");
+    muscle.setActivation(state, 0.6);
+    model.realizeDynamics(state);
+    return muscle.getTendonForce(state);
+}
+} // anonymous namespace
+
+TEST_CASE("DeGrooteFregly2016Muscle parameters applied without initSystem") {
+    const std::string property =
+            GENERATE(as<std::string>{}, "max_isometric_force",
+                    "optimal_fiber_length", "pennation_angle_at_optimal");
+    CAPTURE(property);
+    const double value = property == "max_isometric_force" ? 45.0
+                       : property == "optimal_fiber_length" ? 0.12 : 0.2;
+
+    MocoProblem problem;
+    problem.setModel(createMuscleModel());
+    problem.setTimeBounds(0, 1);
+    problem.addParameter("p", "/forceset/muscle", property,
+            MocoBounds(0, 100));
+    const MocoProblemRep rep = problem.createRep();
+    rep.applyParametersToModelProperties(SimTK::Vector(1, value), true);
+    const auto& model = rep.getModelDisabledConstraints();
+    const auto& muscle = model.getComponent<Muscle>("/forceset/muscle");
+    CHECK(muscle.getMaxIsometricForce() ==
+            (property == "max_isometric_force" ? value : 30.0));
+
+    // The muscle computes the same force as a model built with the new
+    // value, so none of its cached quantities are stale.
+    auto expectedModel = createMuscleModel();
+    auto& expectedMuscle =
+            expectedModel->updComponent<DeGrooteFregly2016Muscle>(
+                    "/forceset/muscle");
+    Property<double>::updAs(expectedMuscle.updPropertyByName(property))
+            .setValue(value);
+    SimTK::State& expectedState = expectedModel->initSystem();
+    CHECK(calcTendonForce(model, rep.updStateDisabledConstraints()) ==
+            Approx(calcTendonForce(*expectedModel, expectedState))
+                    .epsilon(1e-12));
+
+    // Invalid values are rejected as they are by finalizeFromProperties().
+    if (property == "pennation_angle_at_optimal") {
+        CHECK_THROWS_AS(rep.applyParametersToModelProperties(
+                                SimTK::Vector(1, 2.0), true),
+                InvalidPropertyValue);
+    }
+}
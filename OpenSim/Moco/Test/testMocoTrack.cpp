@@ -16,8 +16,10 @@
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
 
+#include <OpenSim/Actuators/DeGrooteFregly2016Muscle.h>
 #include <OpenSim/Actuators/ModelOperators.h>
 #include <OpenSim/Moco/osimMoco.h>
+#include <OpenSim/Simulation/SimbodyEngine/SliderJoint.h>
 
 #define CATCH_CONFIG_MAIN
 #include "Testing.h"
@@ -67,3 +69,58 @@ TEST_CASE("MocoTrack gait10dof18musc", "[casadi]") {
     CHECK(std.compareContinuousVariablesRMS(
             solution, {{"controls",{}}}) < 1e-2);
 }
+
+TEST_CASE("MocoTrack coarse mesh warm start", "[casadi]") {
+    // A mass hanging from a muscle with activation dynamics and a compliant
+    // tendon, so that the coarse problem simplifies the muscle and the
+    // guess for the activations comes from the coarse controls.
+    Model model;
+    model.setName("hanging_muscle");
+    model.set_gravity(SimTK::Vec3(9.81, 0, 0));
+    auto* body = new Body("body", 0.5, SimTK::Vec3(0), SimTK::Inertia(0));
+    model.addComponent(body);
+    auto* joint = new SliderJoint("joint", model.getGround(), *body);
+    joint->updCoordinate(SliderJoint::Coord::TranslationX).setName("height");
+    model.addComponent(joint);
+    auto* muscle = new DeGrooteFregly2016Muscle();
+    muscle->setName("muscle");
+    muscle->set_max_isometric_force(20.0);
+    muscle->set_optimal_fiber_length(0.10);
+    muscle->set_tendon_slack_length(0.05);
+    muscle->set_tendon_strain_at_one_norm_force(0.10);
+    muscle->set_ignore_activation_dynamics(false);
+    muscle->set_ignore_tendon_compliance(false);
+    muscle->set_fiber_damping(0.01);
+    muscle->set_max_contraction_velocity(10);
+    muscle->addNewPathPoint("origin", model.updGround(), SimTK::Vec3(0));
+    muscle->addNewPathPoint("insertion", *body, SimTK::Vec3(0));
+    model.addForce(muscle);
+
+    const int numRows = 21;
+    std::vector<double> times(numRows);
+    SimTK::Matrix heights(numRows, 1);
+    for (int i = 0; i < numRows; ++i) {
+        times[i] = 0.05 * i;
+        heights(i, 0) = 0.15 + 0.01 * std::sin(2 * SimTK::Pi * times[i]);
+    }
+
+    MocoTrack track;
+    track.setName("testMocoTrack_coarse_mesh_warm_start");
+    track.setModel(ModelProcessor(model));
+    track.setStatesReference(TimeSeriesTable(
+            times, heights, {"/jointset/joint/height/value"}));
+    track.set_mesh_interval(0.05);
+    track.set_coarse_mesh_simplify_muscles(true);
+
+    MocoSolution coldStart = track.solve();
+    REQUIRE(coldStart.success());
+
+    track.set_coarse_mesh_warm_start(true);
+    MocoSolution warmStart = track.solve();
+
+    // The warm start does not change the solution.
+    CHECK(warmStart.success());
+    CHECK(warmStart.getNumTimes() == coldStart.getNumTimes());
+    CHECK(warmStart.compareContinuousVariablesRMS(coldStart,
+                  {{"states", {}}, {"controls", {}}}) < 1e-2);
+}
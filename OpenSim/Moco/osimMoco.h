@@ -46,6 +46,7 @@
 #include "MocoGoal/MocoStepTimeAsymmetryGoal.h"
 #include "MocoGoal/MocoStepLengthAsymmetryGoal.h"
 #include "MocoInverse.h"
+#include "MocoInverseOnline.h"
 #include "MocoParameter.h"
 #include "MocoProblem.h"
 #include "MocoSolver.h"
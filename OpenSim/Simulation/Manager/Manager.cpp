@@ -31,6 +31,8 @@
 #include <OpenSim/Simulation/Model/ControllerSet.h>
 #include <OpenSim/Common/Array.h>
 
+#include <algorithm>
+#include <chrono>
 
 using namespace OpenSim;
 using namespace std;
@@ -99,6 +101,17 @@ setNull()
     _writeToStorage=true;
     _tArray.setSize(0);
     _dtArray.setSize(0);
+    _integMethod = static_cast<int>(IntegratorMethod::RungeKuttaMerson);
+    _integAccuracy = SimTK::NaN;
+    _integMinStepSize = SimTK::NaN;
+    _integMaxStepSize = SimTK::NaN;
+    _integInternalStepLimit = -1;
+    _autoSelectTrialDuration = 0;
+    _autoSelectCandidates.clear();
+    _realTimeStepSize = 0;
+    _realTimeDeadline = 0;
+    _realTimeInitialTime = 0;
+    _realTimeStatistics = RealTimeStatistics();
 }
 
 //_____________________________________________________________________________
@@ -509,48 +522,72 @@ void Manager::setIntegratorMethod(IntegratorMethod integMethod)
         OPENSIM_THROW(Exception, msg);
     }
 
-    auto& sys = _model->getMultibodySystem();
+    // The new integrator uses its default options.
+    _integAccuracy = SimTK::NaN;
+    _integMinStepSize = SimTK::NaN;
+    _integMaxStepSize = SimTK::NaN;
+    _integInternalStepLimit = -1;
+    _integ = createIntegrator(integMethod, _model->getMultibodySystem());
+    _integMethod = static_cast<int>(integMethod);
+}
+
+std::unique_ptr<SimTK::Integrator> Manager::createIntegrator(
+        IntegratorMethod integMethod, const SimTK::System& sys) const
+{
+    std::unique_ptr<SimTK::Integrator> integ;
     switch (integMethod) {
         //case IntegratorMethod::CPodes:
-        //    _integ.reset(new SimTK::CPodesIntegrator(sys));
+        //    integ.reset(new SimTK::CPodesIntegrator(sys));
         //    break;
 
         case IntegratorMethod::ExplicitEuler:
-            _integ.reset(new SimTK::ExplicitEulerIntegrator(sys));
+            integ.reset(new SimTK::ExplicitEulerIntegrator(sys));
             break;
 
         case IntegratorMethod::RungeKutta2:
-            _integ.reset(new SimTK::RungeKutta2Integrator(sys));
+            integ.reset(new SimTK::RungeKutta2Integrator(sys));
             break;
 
         case IntegratorMethod::RungeKutta3:
-            _integ.reset(new SimTK::RungeKutta3Integrator(sys));
+            integ.reset(new SimTK::RungeKutta3Integrator(sys));
             break;
 
         case IntegratorMethod::RungeKuttaFeldberg:
-            _integ.reset(new SimTK::RungeKuttaFeldbergIntegrator(sys));
+            integ.reset(new SimTK::RungeKuttaFeldbergIntegrator(sys));
             break;
 
         case IntegratorMethod::RungeKuttaMerson:
-            _integ.reset(new SimTK::RungeKuttaMersonIntegrator(sys));
+            integ.reset(new SimTK::RungeKuttaMersonIntegrator(sys));
             break;
 
         //case Integrator::SemiExplicitEuler:
-        //    _integ.reset(SimTK::SemiExplicitEulerIntegrator(sys, stepSize));
+        //    integ.reset(SimTK::SemiExplicitEulerIntegrator(sys, stepSize));
         //    break;
 
         case IntegratorMethod::SemiExplicitEuler2:
-            _integ.reset(new SimTK::SemiExplicitEuler2Integrator(sys));
+            integ.reset(new SimTK::SemiExplicitEuler2Integrator(sys));
             break;
 
         case IntegratorMethod::Verlet:
-            _integ.reset(new SimTK::VerletIntegrator(sys));
+            integ.reset(new SimTK::VerletIntegrator(sys));
             break;
 
         default:
             std::string msg = "Integrator method not recognized.";
             OPENSIM_THROW(Exception, msg);
     }
+
+    // Apply the settings the user has already made on this Manager's
+    // integrator.
+    if (!SimTK::isNaN(_integAccuracy) && integ->methodHasErrorControl())
+        integ->setAccuracy(_integAccuracy);
+    if (!SimTK::isNaN(_integMinStepSize))
+        integ->setMinimumStepSize(_integMinStepSize);
+    if (!SimTK::isNaN(_integMaxStepSize))
+        integ->setMaximumStepSize(_integMaxStepSize);
+    if (_integInternalStepLimit > 0)
+        integ->setInternalStepLimit(_integInternalStepLimit);
+    return integ;
 }
 
 /**
@@ -562,6 +599,11 @@ getIntegrator() const
     return *_integ;
 }
 
+Manager::IntegratorMethod Manager::getIntegratorMethod() const
+{
+    return static_cast<IntegratorMethod>(_integMethod);
+}
+
 /**
   * Set the Integrator's accuracy.
   */
@@ -575,16 +617,19 @@ void Manager::setIntegratorAccuracy(double accuracy)
     }
 
     _integ->setAccuracy(accuracy);
+    _integAccuracy = accuracy;
 }
 
 void Manager::setIntegratorMinimumStepSize(double hmin)
 {
     _integ->setMinimumStepSize(hmin);
+    _integMinStepSize = hmin;
 }
 
 void Manager::setIntegratorMaximumStepSize(double hmax)
 {
     _integ->setMaximumStepSize(hmax);
+    _integMaxStepSize = hmax;
 }
 
 //void Manager::setIntegratorFixedStepSize(double stepSize)
@@ -595,6 +640,255 @@ void Manager::setIntegratorMaximumStepSize(double hmax)
 void Manager::setIntegratorInternalStepLimit(int nSteps)
 {
     _integ->setInternalStepLimit(nSteps);
+    _integInternalStepLimit = nSteps;
+}
+
+void Manager::setIntegratorAutoSelect(double trialDuration,
+        const std::vector<IntegratorMethod>& candidates)
+{
+    if (_timeStepper) {
+        std::string msg = "Cannot enable automatic integrator selection ";
+        msg += "after Manager::initialize() has been called.";
+        OPENSIM_THROW(Exception, msg);
+    }
+
+    _autoSelectTrialDuration = trialDuration;
+    _autoSelectCandidates.clear();
+    for (const auto& method : candidates)
+        _autoSelectCandidates.push_back(static_cast<int>(method));
+}
+
+namespace {
+// Whether a state created by another instance of the same model can be
+// copied into `state`.
+bool isCompatibleState(const SimTK::State& state, const SimTK::State& other)
+{
+    return state.getNumSubsystems() == other.getNumSubsystems() &&
+            state.getNY() == other.getNY() &&
+            state.getNQ() == other.getNQ() &&
+            state.getNU() == other.getNU() &&
+            state.getNZ() == other.getNZ() &&
+            state.getSystemTopologyStageVersion() ==
+                    other.getSystemTopologyStageVersion();
+}
+} // anonymous namespace
+
+//_____________________________________________________________________________
+/**
+ * Time the candidate integrators over the trial interval and keep the fastest
+ * one whose final state agrees with a tight-accuracy reference solution to
+ * within the integrator accuracy. Each candidate (and the reference) operates
+ * on its own clone of the model, starting from a copy of the initial state.
+ * The trials run one after another so that each wall time measures only the
+ * cost of its integrator.
+ */
+void Manager::selectIntegrator(const SimTK::State& s)
+{
+    std::vector<IntegratorMethod> candidates;
+    for (int method : _autoSelectCandidates)
+        candidates.push_back(static_cast<IntegratorMethod>(method));
+    if (candidates.empty()) {
+        candidates = {IntegratorMethod::ExplicitEuler,
+                IntegratorMethod::RungeKutta2,
+                IntegratorMethod::RungeKutta3,
+                IntegratorMethod::RungeKuttaFeldberg,
+                IntegratorMethod::RungeKuttaMerson,
+                IntegratorMethod::SemiExplicitEuler2,
+                IntegratorMethod::Verlet};
+    }
+
+    // SimTK::Integrator's default accuracy is 1e-3.
+    const double accuracy =
+            SimTK::isNaN(_integAccuracy) ? 1e-3 : _integAccuracy;
+    const double initialTime = s.getTime();
+    const double finalTime = initialTime + _autoSelectTrialDuration;
+
+    struct IntegratorTrial {
+        std::unique_ptr<Model> model;
+        std::unique_ptr<SimTK::Integrator> integ;
+        SimTK::State state;
+        SimTK::Vector finalY;
+        double wallTime = SimTK::NaN;
+        bool success = false;
+        std::string message;
+    };
+
+    // The first trial is the reference solution.
+    std::vector<IntegratorTrial> trials(candidates.size() + 1);
+    for (int i = 0; i < (int)trials.size(); ++i) {
+        auto& trial = trials[i];
+        trial.model.reset(_model->clone());
+        trial.state = trial.model->initSystem();
+        // The clone's System has the same layout as the original's, so the
+        // trial can start from a copy of the entire initial state (including
+        // discrete variables, e.g., controls and prescribed values).
+        if (isCompatibleState(trial.state, s)) {
+            trial.state = s;
+            trial.state.invalidateAllCacheAtOrAbove(SimTK::Stage::Instance);
+        } else {
+            log_warn("Manager: the state passed to initialize() does not "
+                     "match the model's System; automatic integrator "
+                     "selection uses only its time and continuous "
+                     "variables.");
+            trial.state.setTime(initialTime);
+            trial.state.updY() = s.getY();
+        }
+        const auto& sys = trial.model->getMultibodySystem();
+        if (i == 0) {
+            trial.integ = createIntegrator(
+                    IntegratorMethod::RungeKuttaMerson, sys);
+            trial.integ->setAccuracy(1e-2 * accuracy);
+        } else {
+            trial.integ = createIntegrator(candidates[i - 1], sys);
+        }
+        trial.integ->setFinalTime(finalTime);
+    }
+
+    auto runTrial = [finalTime](IntegratorTrial& trial) {
+        try {
+            const auto start = std::chrono::steady_clock::now();
+            SimTK::TimeStepper ts(
+                    trial.model->getMultibodySystem(), *trial.integ);
+            ts.initialize(trial.state);
+            trial.success = true;
+            while (ts.getTime() < finalTime) {
+                ts.stepTo(finalTime);
+                if (trial.integ->isSimulationOver() &&
+                        trial.integ->getTerminationReason() !=
+                                SimTK::Integrator::ReachedFinalTime) {
+                    trial.success = false;
+                    trial.message = trial.integ->getTerminationReasonString(
+                            trial.integ->getTerminationReason());
+                    break;
+                }
+            }
+            trial.finalY = ts.getState().getY();
+            trial.wallTime = std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start).count();
+        } catch (const std::exception& e) {
+            trial.success = false;
+            trial.message = e.what();
+        }
+    };
+
+    for (auto& trial : trials) runTrial(trial);
+
+    const auto& reference = trials[0];
+    if (!reference.success) {
+        log_warn("Manager: automatic integrator selection failed to compute "
+                 "a reference solution ({}); keeping integrator {}.",
+                reference.message, _integ->getMethodName());
+        return;
+    }
+
+    log_info("Manager: automatic integrator selection over [{}, {}] s "
+             "(accuracy {}, reference wall time {:.4g} s):",
+            initialTime, finalTime, accuracy, reference.wallTime);
+    int best = -1;
+    for (int i = 1; i < (int)trials.size(); ++i) {
+        const auto& trial = trials[i];
+        const std::string name = trial.integ->getMethodName();
+        if (!trial.success) {
+            log_info("    {:<20} failed: {}", name, trial.message);
+            continue;
+        }
+        double error = 0;
+        for (int iy = 0; iy < reference.finalY.size(); ++iy) {
+            const double ref = reference.finalY[iy];
+            error = std::max(error, std::abs(trial.finalY[iy] - ref) /
+                                            std::max(1.0, std::abs(ref)));
+        }
+        const bool accurate = error <= accuracy;
+        log_info("    {:<20} wall time: {:.4g} s, error: {:.3g}{}", name,
+                trial.wallTime, error, accurate ? "" : " (inaccurate)");
+        if (accurate &&
+                (best == -1 || trial.wallTime < trials[best].wallTime)) {
+            best = i;
+        }
+    }
+
+    if (best == -1) {
+        log_warn("Manager: no candidate integrator met the accuracy target; "
+                 "keeping integrator {}.", _integ->getMethodName());
+        return;
+    }
+
+    // Keep the integrator settings the user has made on this Manager.
+    _integ = createIntegrator(
+            candidates[best - 1], _model->getMultibodySystem());
+    _integMethod = static_cast<int>(candidates[best - 1]);
+    log_info("Manager: selected integrator {}.", _integ->getMethodName());
+}
+
+//-----------------------------------------------------------------------------
+// REAL-TIME STEPPING
+//-----------------------------------------------------------------------------
+void Manager::setRealTimeMode(double stepSize, double deadline)
+{
+    if (_timeStepper) {
+        std::string msg = "Cannot enable real-time mode ";
+        msg += "after Manager::initialize() has been called.";
+        OPENSIM_THROW(Exception, msg);
+    }
+    OPENSIM_THROW_IF(stepSize <= 0, Exception,
+            "Expected the real-time step size to be positive, but got {}.",
+            stepSize);
+
+    _realTimeStepSize = stepSize;
+    _realTimeDeadline = deadline > 0 ? deadline : stepSize;
+    // Nothing may be written on the hot path.
+    _performAnalyses = false;
+    _writeToStorage = false;
+}
+
+const SimTK::State& Manager::stepRealTime()
+{
+    OPENSIM_THROW_IF(_realTimeStepSize <= 0, Exception,
+            "Real-time mode is not enabled. Call "
+            "Manager::setRealTimeMode() before Manager::initialize().");
+    if (_timeStepper == nullptr) {
+        throw Exception("Manager::stepRealTime(): Manager has not been "
+            "initialized. Call Manager::initialize() first.");
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    auto& stats = _realTimeStatistics;
+    const double target =
+            _realTimeInitialTime + (stats.numSteps + 1) * _realTimeStepSize;
+    // stepTo() returns early at events (all significant states are
+    // reported), so keep stepping until the end of the frame.
+    while (_integ->getState().getTime() < target) {
+        _timeStepper->stepTo(target);
+        if (_integ->isSimulationOver() &&
+                _integ->getState().getTime() < target) {
+            OPENSIM_THROW(Exception,
+                    "Manager::stepRealTime(): integration stopped at time {} "
+                    "before the end of the step at time {}: {}",
+                    _integ->getState().getTime(), target,
+                    _integ->getTerminationReasonString(
+                            _integ->getTerminationReason()));
+        }
+    }
+
+    const double stepTime = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+    ++stats.numSteps;
+    stats.lastStepTime = stepTime;
+    stats.totalStepTime += stepTime;
+    if (stepTime > stats.maxStepTime) stats.maxStepTime = stepTime;
+    if (stepTime > _realTimeDeadline) ++stats.numOverruns;
+
+    return _integ->getState();
+}
+
+void Manager::logRealTimeStatistics() const
+{
+    const auto& stats = _realTimeStatistics;
+    log_info("Manager: {} real-time step(s) of {} s; mean step time {:.3g} "
+             "s, max step time {:.3g} s, {} overrun(s) of the {} s deadline.",
+            stats.numSteps, _realTimeStepSize, stats.getMeanStepTime(),
+            stats.maxStepTime, stats.numOverruns, _realTimeDeadline);
 }
 
 //=============================================================================
@@ -816,6 +1110,14 @@ void Manager::initialize(const SimTK::State& s)
     }
 
     else {
+        if (_autoSelectTrialDuration > 0) selectIntegrator(s);
+        if (_realTimeStepSize > 0) {
+            // Fixed steps have a bounded number of function evaluations.
+            _integ->setFixedStepSize(_realTimeStepSize);
+            _realTimeInitialTime = s.getTime();
+            _realTimeStatistics = RealTimeStatistics();
+        }
+
         _timeStepper.reset(
             new SimTK::TimeStepper(_model->getMultibodySystem(), *_integ));
         _timeStepper->initialize(s);
@@ -33,6 +33,7 @@
 #include "OpenSim/Common/TimeSeriesTable.h"
 #include <OpenSim/Simulation/osimSimulationDLL.h>
 #include <SimTKcommon/internal/ReferencePtr.h>
+#include <vector>
 
 namespace SimTK {
 class Integrator;
@@ -81,6 +82,31 @@ private:
     /** Integrator. */
     std::unique_ptr<SimTK::Integrator> _integ;
 
+    /** Method of the current integrator. */
+    int _integMethod;
+
+    /** Integrator settings, remembered so that they can be applied to the
+    integrators created during automatic integrator selection. NaN (or -1 for
+    the step limit) means the integrator's default is used. */
+    double _integAccuracy;
+    double _integMinStepSize;
+    double _integMaxStepSize;
+    int _integInternalStepLimit;
+
+    /** Duration of the trial interval used for automatic integrator
+    selection. Automatic selection is disabled if this is not positive. */
+    double _autoSelectTrialDuration;
+    /** Integrator methods that compete during automatic selection. */
+    std::vector<int> _autoSelectCandidates;
+
+    /** Fixed step size used in real-time mode. Real-time mode is disabled if
+    this is not positive. */
+    double _realTimeStepSize;
+    /** Wall-clock budget (seconds) for a single real-time step. */
+    double _realTimeDeadline;
+    /** Time at which real-time stepping started. */
+    double _realTimeInitialTime;
+
     /** TimeStepper */
     std::unique_ptr<SimTK::TimeStepper> _timeStepper;
 
@@ -213,6 +239,36 @@ public:
 
     SimTK::Integrator& getIntegrator() const;
 
+    /** Get the method of the current integrator. If automatic integrator
+      * selection is enabled, this returns the selected method after
+      * initialize() has been called. */
+    IntegratorMethod getIntegratorMethod() const;
+
+    /** Enable automatic integrator selection. When the Manager is
+      * initialized, each candidate integrator method integrates a copy of the
+      * model over the trial interval [t0, t0 + trialDuration] from the initial
+      * state. The candidates run one after another, each on its own clone of
+      * the model and starting from a copy of the initial state. The final
+      * state of each candidate is compared to a reference solution computed
+      * with a tighter accuracy (1% of the integrator accuracy), and the
+      * fastest candidate whose error is within the integrator accuracy (see
+      * setIntegratorAccuracy()) is used for the actual simulation. The
+      * timings and errors of all candidates are logged. The trial
+      * integrations are discarded; the simulation still starts from the
+      * state passed to initialize().
+      *
+      * If no candidate meets the accuracy target (or all candidates fail),
+      * the current integrator method is kept.
+      *
+      * @param trialDuration Length of the trial interval (seconds). Use a
+      *        non-positive value to disable automatic selection.
+      * @param candidates Integrator methods to compare. If empty, all
+      *        methods in IntegratorMethod are used.
+      *
+      * This must be called before `Manager::initialize()`. */
+    void setIntegratorAutoSelect(double trialDuration,
+            const std::vector<IntegratorMethod>& candidates = {});
+
     /** Sets the accuracy of the integrator. 
       * For more details, see `SimTK::Integrator::setAccuracy(SimTK::Real)`. */
     void setIntegratorAccuracy(double accuracy);
@@ -235,6 +291,67 @@ public:
    
     /** @} */
 
+    /** @name Real-time stepping
+      * Real-time mode is intended for using a Model as the plant in a
+      * fixed-rate control loop (e.g., hardware-in-the-loop). Each call to
+      * stepRealTime() advances the simulation by exactly one fixed step
+      * using the current integrator in fixed-step mode, so the number of
+      * function evaluations per step is bounded (e.g., 2 for RungeKutta2, 5
+      * for RungeKuttaMerson). Analyses and Storage writes are disabled.
+      * The wall-clock time spent in each step is compared to a deadline and
+      * overruns are counted; nothing is logged while stepping.
+      *
+      * Controllers in the Model are evaluated as usual during each step.
+      *
+      * @code
+      * Manager manager(model);
+      * manager.setIntegratorMethod(Manager::IntegratorMethod::RungeKutta2);
+      * manager.setRealTimeMode(0.001);
+      * manager.initialize(state);
+      * while (running) {
+      *     const SimTK::State& s = manager.stepRealTime();
+      *     // ... exchange data with the hardware ...
+      * }
+      * manager.logRealTimeStatistics();
+      * @endcode
+      * @{ */
+
+    /** Per-step timing statistics collected in real-time mode. Times are
+      * wall-clock times in seconds. */
+    struct RealTimeStatistics {
+        int numSteps = 0;
+        int numOverruns = 0;
+        double lastStepTime = 0;
+        double maxStepTime = 0;
+        double totalStepTime = 0;
+        double getMeanStepTime() const
+        {   return numSteps ? totalStepTime / numSteps : 0; }
+    };
+
+    /** Enable real-time mode with the given fixed step size (seconds). The
+      * deadline is the wall-clock time budget for each step; if it is not
+      * positive (the default), the step size is used. This must be called
+      * before `Manager::initialize()`, and it disables analyses and writing
+      * states to Storage. */
+    void setRealTimeMode(double stepSize, double deadline = -1);
+
+    /** Advance the simulation by one fixed step in real-time mode and return
+      * the new state. The step that ends at time t0 + n * stepSize is the
+      * n-th step, so no round-off accumulates in the time. If the
+      * integration stops before the end of the step (e.g., the integrator
+      * fails), an Exception is thrown and the step is not counted. */
+    const SimTK::State& stepRealTime();
+
+    /** Get the timing statistics of the real-time steps taken so far. */
+    const RealTimeStatistics& getRealTimeStatistics() const
+    {   return _realTimeStatistics; }
+
+    /** Log a summary of the real-time statistics. Call this outside of the
+      * control loop. */
+    void logRealTimeStatistics() const;
+
+    /** @} */
+
     // SPECIFIED TIME STEP
     void setUseSpecifiedDT(bool aTrueFalse);
     bool getUseSpecifiedDT() const;
@@ -356,6 +473,16 @@ private:
     // Handles common tasks of some of the other constructors.
     Manager(Model& model, bool dummyVar);
 
+    // Create an integrator of the given method for the given system, with
+    // the integrator settings of this Manager applied.
+    std::unique_ptr<SimTK::Integrator> createIntegrator(
+            IntegratorMethod integMethod, const SimTK::System& sys) const;
+
+    // Run the candidate integrators over the trial interval starting at the
+    // given state and switch to the fastest one that meets the accuracy
+    // target.
+    void selectIntegrator(const SimTK::State& s);
+
     // Helper functions during initialization of integration
     void initializeStorageAndAnalyses(const SimTK::State& s);
 
@@ -363,6 +490,9 @@ private:
     // step = 0 is the beginning, step = -1 used to denote the end/final step
     void record(const SimTK::State& s, const int& step);
 
+    /** Timing statistics of real-time steps. */
+    RealTimeStatistics _realTimeStatistics;
+
 //=============================================================================
 };  // END of class Manager
 
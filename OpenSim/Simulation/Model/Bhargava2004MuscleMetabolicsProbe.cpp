@@ -271,6 +271,10 @@ computeProbeInputs(const State& s) const
         EdotOutput(1) = Bdot;    // BASAL metabolic power storage
 
 
+    // Argument to the fiber length dependence function, reused for all
+    // muscles.
+    Vector fiberLengthArg(1);
+
     // Loop through each muscle in the MetabolicMuscleParameterSet
     const int nM = 
         get_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet()
@@ -331,8 +335,8 @@ computeProbeInputs(const State& s) const
         // ------------------------------------------
         if (get_forbid_negative_total_power() || get_maintenance_rate_on())
         {
-            Vector tmp(1, fiber_length_normalized);
-            fiber_length_dependence = get_normalized_fiber_length_dependence_on_maintenance_rate().calcValue(tmp);
+            fiberLengthArg[0] = fiber_length_normalized;
+            fiber_length_dependence = get_normalized_fiber_length_dependence_on_maintenance_rate().calcValue(fiberLengthArg);
             
             Mdot = mm.getMuscleMass() * fiber_length_dependence * 
                 ( (mm.get_maintenance_constant_slow_twitch() * slow_twitch_excitation) + (mm.get_maintenance_constant_fast_twitch() * fast_twitch_excitation) );
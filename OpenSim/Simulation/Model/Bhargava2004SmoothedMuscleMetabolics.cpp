@@ -38,13 +38,15 @@ Bhargava2004SmoothedMuscleMetabolics_MuscleParameters::
 // Set the muscle mass internal member variable muscleMass based on
 // whether the use_provided_muscle_mass property is true or false.
 void Bhargava2004SmoothedMuscleMetabolics_MuscleParameters::setMuscleMass() {
+    muscleMass = calcMuscleMass();
+}
+
+double Bhargava2004SmoothedMuscleMetabolics_MuscleParameters::calcMuscleMass()
+        const {
     if (get_use_provided_muscle_mass())
-        muscleMass = get_provided_muscle_mass();
-    else {
-        muscleMass =
-            (getMuscle().getMaxIsometricForce() / get_specific_tension())
+        return get_provided_muscle_mass();
+    return (getMuscle().getMaxIsometricForce() / get_specific_tension())
             * get_density() * getMuscle().getOptimalFiberLength();
-        }
 }
 
 void Bhargava2004SmoothedMuscleMetabolics_MuscleParameters::
@@ -252,12 +254,33 @@ double Bhargava2004SmoothedMuscleMetabolics::getMuscleMetabolicRate(
 void Bhargava2004SmoothedMuscleMetabolics::extendRealizeTopology(
         SimTK::State& state) const {
     Super::extendRealizeTopology(state);
+    m_muscleBlocks.clear();
     m_muscleIndices.clear();
     for (int i = 0; i < getProperty_muscle_parameters().size(); ++i) {
-        const auto& muscle = get_muscle_parameters(i).getMuscle();
-        if (muscle.get_appliesForce()) {
-            m_muscleIndices[muscle.getAbsolutePathString()] = i;
-        }
+        const auto& muscleParameter = get_muscle_parameters(i);
+        const auto& muscle = muscleParameter.getMuscle();
+        if (!muscle.get_appliesForce()) continue;
+
+        MuscleParameterBlock block;
+        block.muscle = &muscle;
+        block.parameters = &muscleParameter;
+        // The muscle mass is computed here rather than taken from
+        // getMuscleMass(), which is only set by addMuscle(), so that it is
+        // also valid for deserialized models.
+        block.mass = muscleParameter.calcMuscleMass();
+        block.ratioSlowTwitch = muscleParameter.get_ratio_slow_twitch_fibers();
+        block.activationConstantSlowTwitch =
+                muscleParameter.get_activation_constant_slow_twitch();
+        block.activationConstantFastTwitch =
+                muscleParameter.get_activation_constant_fast_twitch();
+        block.maintenanceConstantSlowTwitch =
+                muscleParameter.get_maintenance_constant_slow_twitch();
+        block.maintenanceConstantFastTwitch =
+                muscleParameter.get_maintenance_constant_fast_twitch();
+
+        m_muscleIndices[muscle.getAbsolutePathString()] =
+                (int)m_muscleBlocks.size();
+        m_muscleBlocks.push_back(block);
     }
 }
 
@@ -340,42 +363,56 @@ void Bhargava2004SmoothedMuscleMetabolics::calcMetabolicRate(
         SimTK::Vector& maintenanceRatesForMuscles,
         SimTK::Vector& shorteningRatesForMuscles,
         SimTK::Vector& mechanicalWorkRatesForMuscles) const {
-    totalRatesForMuscles.resize((int)m_muscleIndices.size());
-    activationRatesForMuscles.resize((int)m_muscleIndices.size());
-    maintenanceRatesForMuscles.resize((int)m_muscleIndices.size());
-    shorteningRatesForMuscles.resize((int)m_muscleIndices.size());
-    mechanicalWorkRatesForMuscles.resize((int)m_muscleIndices.size());
+    const int numMuscles = (int)m_muscleBlocks.size();
+    totalRatesForMuscles.resize(numMuscles);
+    activationRatesForMuscles.resize(numMuscles);
+    maintenanceRatesForMuscles.resize(numMuscles);
+    shorteningRatesForMuscles.resize(numMuscles);
+    mechanicalWorkRatesForMuscles.resize(numMuscles);
     double activationHeatRate, maintenanceHeatRate, shorteningHeatRate;
     double mechanicalWorkRate;
     activationHeatRate = maintenanceHeatRate = shorteningHeatRate =
         mechanicalWorkRate = 0;
 
-    int i = 0;
-    for (const auto& muscleIndex : m_muscleIndices) {
+    // These properties are the same for all muscles; read them once.
+    const double effortScalingFactor = get_muscle_effort_scaling_factor();
+    const bool useForceDependentShorteningPropConstant =
+            get_use_force_dependent_shortening_prop_constant();
+    const bool includeNegativeMechanicalWork =
+            get_include_negative_mechanical_work();
+    const bool forbidNegativeTotalPower = get_forbid_negative_total_power();
+    const bool enforceMinimumHeatRatePerMuscle =
+            get_enforce_minimum_heat_rate_per_muscle();
+    const bool useSmoothing = get_use_smoothing();
+    const double velocitySmoothing = get_velocity_smoothing();
+    const double powerSmoothing = get_power_smoothing();
+    const double heatRateSmoothing = get_heat_rate_smoothing();
 
-        const auto& muscleParameter =
-            get_muscle_parameters(muscleIndex.second);
-        const auto& muscle = muscleParameter.getMuscle();
+    // Reused argument to the fiber length dependence curve.
+    SimTK::Vector fiberLengthArg(1);
+
+    for (int i = 0; i < numMuscles; ++i) {
+
+        const auto& block = m_muscleBlocks[i];
+        const auto& muscle = *block.muscle;
 
         const double maximalIsometricForce = muscle.getMaxIsometricForce();
         const double activation =
-            get_muscle_effort_scaling_factor() * muscle.getActivation(s);
+            effortScalingFactor * muscle.getActivation(s);
         const double excitation =
-            get_muscle_effort_scaling_factor() * muscle.getControl(s);
+            effortScalingFactor * muscle.getControl(s);
         const double fiberForcePassive =  muscle.getPassiveFiberForce(s);
         const double fiberForceActive =
-            get_muscle_effort_scaling_factor() * muscle.getActiveFiberForce(s);
+            effortScalingFactor * muscle.getActiveFiberForce(s);
         const double fiberForceTotal =
             fiberForceActive + fiberForcePassive;
         const double fiberLengthNormalized =
             muscle.getNormalizedFiberLength(s);
         const double fiberVelocity = muscle.getFiberVelocity(s);
         const double slowTwitchExcitation =
-            muscleParameter.get_ratio_slow_twitch_fibers()
-            * sin(SimTK::Pi/2 * excitation);
+            block.ratioSlowTwitch * sin(SimTK::Pi/2 * excitation);
         const double fastTwitchExcitation =
-            (1 - muscleParameter.get_ratio_slow_twitch_fibers())
-            * (1 - cos(SimTK::Pi/2 * excitation));
+            (1 - block.ratioSlowTwitch) * (1 - cos(SimTK::Pi/2 * excitation));
         // This small constant is added to the fiber velocity to prevent
         // dividing by 0 (in case the actual fiber velocity is null) when using
         // the Huber loss smoothing approach, thereby preventing singularities.
@@ -395,21 +432,21 @@ void Bhargava2004SmoothedMuscleMetabolics::calcMetabolicRate(
         // We will ignore this function and use 1.0 for now.
         const double decay_function_value = 1.0;
         activationHeatRate =
-            muscleParameter.getMuscleMass() * decay_function_value
-            * ( (muscleParameter.get_activation_constant_slow_twitch()
-                        * slowTwitchExcitation)
-                + (muscleParameter.get_activation_constant_fast_twitch()
+            block.mass * decay_function_value
+            * ( (block.activationConstantSlowTwitch * slowTwitchExcitation)
+                + (block.activationConstantFastTwitch
                         * fastTwitchExcitation) );
 
         // MAINTENANCE HEAT RATE (W).
         // --------------------------
-        const double fiber_length_dependence = m_fiberLengthDepCurve.calcValue(
-                    SimTK::Vector(1, fiberLengthNormalized));
+        fiberLengthArg[0] = fiberLengthNormalized;
+        const double fiber_length_dependence =
+                m_fiberLengthDepCurve.calcValue(fiberLengthArg);
         maintenanceHeatRate =
-            muscleParameter.getMuscleMass() * fiber_length_dependence
-                * ( (muscleParameter.get_maintenance_constant_slow_twitch()
+            block.mass * fiber_length_dependence
+                * ( (block.maintenanceConstantSlowTwitch
                             * slowTwitchExcitation)
-                + (muscleParameter.get_maintenance_constant_fast_twitch()
+                + (block.maintenanceConstantFastTwitch
                             * fastTwitchExcitation) );
 
         // SHORTENING HEAT RATE (W).
@@ -417,7 +454,7 @@ void Bhargava2004SmoothedMuscleMetabolics::calcMetabolicRate(
         //     fiberVelocity>0 as lengthening.
         // ---------------------------------------------------------
         double alpha;
-        if (get_use_force_dependent_shortening_prop_constant()) {
+        if (useForceDependentShorteningPropConstant) {
             // Even when using the Huber loss smoothing approach, we still rely
             // on a tanh approximation for the shortening heat rate when using
             // the force dependent shortening proportional constant. This is
@@ -431,7 +468,7 @@ void Bhargava2004SmoothedMuscleMetabolics::calcMetabolicRate(
                     (0.16 * isometricTotalActiveForce)
                     + (0.18 * fiberForceTotal),
                     0.157 * fiberForceTotal,
-                    get_velocity_smoothing(),
+                    velocitySmoothing,
                     -1);
         } else {
             // This simpler value of alpha comes from Frank Anderson's 1999
@@ -440,7 +477,7 @@ void Bhargava2004SmoothedMuscleMetabolics::calcMetabolicRate(
             alpha = m_conditional(fiberVelocity + eps,
                     0.25 * fiberForceTotal,
                     0,
-                    get_velocity_smoothing(),
+                    velocitySmoothing,
                     -1);
         }
         shorteningHeatRate = -alpha * (fiberVelocity + eps);
@@ -449,14 +486,14 @@ void Bhargava2004SmoothedMuscleMetabolics::calcMetabolicRate(
         // --> note that we define fiberVelocity<0 as shortening and
         //     fiberVelocity>0 as lengthening.
         // -------------------------------------------------------------------
-        if (get_include_negative_mechanical_work())
+        if (includeNegativeMechanicalWork)
         {
             mechanicalWorkRate = -fiberForceActive * fiberVelocity;
         } else {
             mechanicalWorkRate = m_conditional(fiberVelocity + eps,
                     -fiberForceActive * fiberVelocity,
                     0,
-                    get_velocity_smoothing(),
+                    velocitySmoothing,
                     -1);
         }
 
@@ -464,29 +501,29 @@ void Bhargava2004SmoothedMuscleMetabolics::calcMetabolicRate(
         // ------------------------------------------
         if (SimTK::isNaN(activationHeatRate))
             std::cout << "WARNING::" << getName() << ": activationHeatRate ("
-                    << muscleParameter.getName() << ") = NaN!" << std::endl;
+                    << block.parameters->getName() << ") = NaN!" << std::endl;
         if (SimTK::isNaN(maintenanceHeatRate))
             std::cout << "WARNING::" << getName() << ": maintenanceHeatRate ("
-                    << muscleParameter.getName() << ") = NaN!" << std::endl;
+                    << block.parameters->getName() << ") = NaN!" << std::endl;
         if (SimTK::isNaN(shorteningHeatRate))
             std::cout << "WARNING::" << getName() << ": shorteningHeatRate ("
-                    << muscleParameter.getName() << ") = NaN!" << std::endl;
+                    << block.parameters->getName() << ") = NaN!" << std::endl;
         if (SimTK::isNaN(mechanicalWorkRate))
             std::cout << "WARNING::" << getName() << ": mechanicalWorkRate ("
-                    <<  muscleParameter.getName() << ") = NaN!" << std::endl;
+                    << block.parameters->getName() << ") = NaN!" << std::endl;
 
         // If necessary, increase the shortening heat rate so that the total
         // power is non-negative.
-        if (get_forbid_negative_total_power()) {
+        if (forbidNegativeTotalPower) {
             const double Edot_W_beforeClamp = activationHeatRate
                 + maintenanceHeatRate + shorteningHeatRate
                 + mechanicalWorkRate;
-            if (get_use_smoothing()) {
+            if (useSmoothing) {
                 const double Edot_W_beforeClamp_smoothed = m_conditional(
                         -Edot_W_beforeClamp,
                         0,
                         Edot_W_beforeClamp,
-                        get_power_smoothing(),
+                        powerSmoothing,
                         1);
                 shorteningHeatRate -= Edot_W_beforeClamp_smoothed;
             } else {
@@ -504,21 +541,21 @@ void Bhargava2004SmoothedMuscleMetabolics::calcMetabolicRate(
         // --------------------------------------------------------------------
         double totalHeatRate = activationHeatRate + maintenanceHeatRate
             + shorteningHeatRate;
-        if (get_use_smoothing()) {
-            if (get_enforce_minimum_heat_rate_per_muscle())
+        if (useSmoothing) {
+            if (enforceMinimumHeatRatePerMuscle)
             {
                 totalHeatRate = m_conditional(
-                        -totalHeatRate + 1.0 * muscleParameter.getMuscleMass(),
+                        -totalHeatRate + 1.0 * block.mass,
                         totalHeatRate,
-                        1.0 * muscleParameter.getMuscleMass(),
-                        get_heat_rate_smoothing(),
+                        1.0 * block.mass,
+                        heatRateSmoothing,
                         1);
             }
         } else {
-            if (get_enforce_minimum_heat_rate_per_muscle()
-                    && totalHeatRate < 1.0 * muscleParameter.getMuscleMass())
+            if (enforceMinimumHeatRatePerMuscle
+                    && totalHeatRate < 1.0 * block.mass)
             {
-                totalHeatRate = 1.0 * muscleParameter.getMuscleMass();
+                totalHeatRate = 1.0 * block.mass;
             }
         }
 
@@ -531,8 +568,6 @@ void Bhargava2004SmoothedMuscleMetabolics::calcMetabolicRate(
         maintenanceRatesForMuscles[i] = maintenanceHeatRate;
         shorteningRatesForMuscles[i] = shorteningHeatRate;
         mechanicalWorkRatesForMuscles[i] = mechanicalWorkRate;
-
-        ++i;
     }
 }
 
@@ -21,6 +21,7 @@
 
 #include <OpenSim/Moco/osimMocoDLL.h>
 #include <unordered_map>
+#include <vector>
 
 #include <OpenSim/Common/PiecewiseLinearFunction.h>
 #include <OpenSim/Simulation/Model/ModelComponent.h>
@@ -72,6 +73,9 @@ public:
 
     double getMuscleMass() const { return muscleMass; }
     void setMuscleMass();
+    /** Compute the muscle mass from the properties of this object and the
+    connected muscle, without changing the stored muscle mass. */
+    double calcMuscleMass() const;
 
     const Muscle& getMuscle() const { return getConnectee<Muscle>("muscle"); }
 
@@ -368,6 +372,25 @@ private:
             SimTK::Vector& maintenanceRatesForMuscles,
             SimTK::Vector& shorteningRatesForMuscles,
             SimTK::Vector& mechanicalWorkRatesForMuscles) const;
+    // Parameters of a single muscle that are fixed once the system has been
+    // created, gathered so that calcMetabolicRate() does not look up
+    // properties or sockets inside its loop over muscles.
+    struct MuscleParameterBlock {
+        const Muscle* muscle = nullptr;
+        const Bhargava2004SmoothedMuscleMetabolics_MuscleParameters*
+                parameters = nullptr;
+        double mass = SimTK::NaN;
+        double ratioSlowTwitch = SimTK::NaN;
+        double activationConstantSlowTwitch = SimTK::NaN;
+        double activationConstantFastTwitch = SimTK::NaN;
+        double maintenanceConstantSlowTwitch = SimTK::NaN;
+        double maintenanceConstantFastTwitch = SimTK::NaN;
+    };
+    // One entry per muscle that applies force, in the order of the entries of
+    // the cached rate vectors.
+    mutable std::vector<MuscleParameterBlock> m_muscleBlocks;
+    // Map from muscle path (the channel name of muscle_metabolic_rate) to the
+    // muscle's position in m_muscleBlocks and in the cached rate vectors.
     mutable std::unordered_map<std::string, int> m_muscleIndices;
     using ConditionalFunction =
             double(const double&, const double&, const double&, const double&,
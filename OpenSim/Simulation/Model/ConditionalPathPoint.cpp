@@ -103,6 +103,15 @@ void ConditionalPathPoint::updateFromXMLNode(SimTK::Xml::Element& node,
     Super::updateFromXMLNode(node, versionNumber);
 }
 
+void ConditionalPathPoint::extendConnectToModel(Model& model)
+{
+    Super::extendConnectToModel(model);
+    _coordinate.reset();
+    if (getSocket<Coordinate>("coordinate").isConnected()) {
+        _coordinate.reset(&getConnectee<Coordinate>("coordinate"));
+    }
+}
+
 //_____________________________________________________________________________
 /*
  * Connect properties to local pointers.
@@ -159,8 +168,8 @@ void ConditionalPathPoint::setRangeMax(double maxVal)
  */
 bool ConditionalPathPoint::isActive(const SimTK::State& s) const
 {
-    if (getSocket<Coordinate>("coordinate").isConnected()) {
-        double value = getConnectee<Coordinate>("coordinate").getValue(s);
+    if (!_coordinate.empty()) {
+        double value = _coordinate->getValue(s);
         if (value >= get_range(0) - 1e-5 &&
              value <= get_range(1) + 1e-5)
             return true;
@@ -78,6 +78,11 @@ public:
 private:
     void constructProperties();
     void updateFromXMLNode(SimTK::Xml::Element& node, int versionNumber) override;
+    void extendConnectToModel(Model& model) override;
+
+    // Hang on to the Coordinate instead of finding the socket's connectee
+    // each time the path is computed.
+    SimTK::ReferencePtr<const Coordinate> _coordinate;
 //=============================================================================
 };  // END of class ConditionalPathPoint
 //=============================================================================
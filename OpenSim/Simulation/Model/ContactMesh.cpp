@@ -24,6 +24,7 @@
 #include <fstream>
 #include <OpenSim/Common/IO.h>
 #include "ContactMesh.h"
+#include "MeshFileCache.h"
 #include "Model.h"
 
 namespace OpenSim {
@@ -49,10 +50,7 @@ ContactMesh::ContactMesh(const std::string& filename,
         if (file.fail())
             throw Exception("Error loading mesh file: "+filename+". The file should exist in same folder with model.\n Model loading is aborted.");
         file.close();
-        SimTK::PolygonalMesh mesh;
-        mesh.loadFile(filename);
-        _geometry.reset(new SimTK::ContactGeometry::TriangleMesh(mesh));
-        _decorativeGeometry.reset(new SimTK::DecorativeMesh(mesh));
+        // The mesh is loaded when the contact geometry is first created.
     }
 }
 
@@ -79,6 +77,7 @@ void ContactMesh::constructProperties()
 void ContactMesh::extendFinalizeFromProperties() {
     _geometry.reset();
     _decorativeGeometry.reset();
+    _meshFile.reset();
 }
 
 const std::string& ContactMesh::getFilename() const
@@ -91,12 +90,12 @@ void ContactMesh::setFilename(const std::string& filename)
     set_filename(filename);
     _geometry.reset();
     _decorativeGeometry.reset();
+    _meshFile.reset();
 }
 
 SimTK::ContactGeometry::TriangleMesh* ContactMesh::
     loadMesh(const std::string& filename) const
 {
-    SimTK::PolygonalMesh mesh;
     std::ifstream file;
     assert (_model);
 
@@ -113,7 +112,10 @@ SimTK::ContactGeometry::TriangleMesh* ContactMesh::
                 "Loading is aborted.");
     }
     file.close();
-    mesh.loadFile(filename);
+    // Copies of this mesh (e.g., in copies of the model) share the mesh
+    // read from the file.
+    _meshFile = MeshFileCache::load(filename);
+    const SimTK::PolygonalMesh& mesh = _meshFile->getMesh();
     _decorativeGeometry.reset(new SimTK::DecorativeMesh(mesh));
     return new SimTK::ContactGeometry::TriangleMesh(mesh);
 }
@@ -115,6 +115,9 @@ private:
         _geometry;
     mutable SimTK::ResetOnCopy<std::unique_ptr<SimTK::DecorativeMesh>>
         _decorativeGeometry;
+    // The mesh read from the file, which is shared through the MeshFileCache.
+    mutable SimTK::ResetOnCopy<std::shared_ptr<const SimTK::DecorativeMeshFile>>
+        _meshFile;
 
 //=============================================================================
 };  // END of class ContactMesh
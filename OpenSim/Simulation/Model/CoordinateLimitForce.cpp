@@ -32,6 +32,19 @@
 using namespace OpenSim;
 using namespace std;
 
+namespace {
+// Smooth step from y0 (at x <= x0) to y1 (at x >= x1). This gives the same
+// value as SimTK::Function::Step(y0, y1, x0, x1).calcValue(), but it is
+// inlined and does not allocate a SimTK::Vector for its argument; it is
+// evaluated every time the force is computed.
+inline double smoothStep(double y0, double y1, double x0, double x1, double x)
+{
+    if (x <= x0) return y0;
+    if (x >= x1) return y1;
+    return y0 + (y1 - y0)*SimTK::stepUp((x - x0)/(x1 - x0));
+}
+}
+
 //=============================================================================
 // CONSTRUCTOR(S) AND DESTRUCTOR
 //=============================================================================
@@ -73,11 +86,10 @@ CoordinateLimitForce::CoordinateLimitForce
 void CoordinateLimitForce::setNull()
 {
     setAuthors("Ajay Seth");
-    _upStep.reset();
-    _loStep.reset();
-    
+
     // Scaling for coordinate values in m or degrees (rotational) 
     _w = SimTK::NaN;
+    _trans = SimTK::NaN;
 
     // Coordinate limits in internal (SI) units (m or rad)
     _qup = SimTK::NaN;
@@ -218,14 +230,7 @@ void CoordinateLimitForce::extendConnectToModel(Model& aModel)
     _Kup = upperStiffness/_w;
     _Klow = lowerStiffness/_w;
     _damp = damping/_w;
-
-    // Define the transition from no stiffness to the upperStiffness as coordinate increases 
-    // beyond the upper limit
-    _upStep.reset(
-            new SimTK::Function::Step(0.0, _Kup, _qup, _qup+_w*transition));
-    // Define the transition from lowerStiffness to zero as coordinate increases to the lower limit
-    _loStep.reset(
-            new SimTK::Function::Step(_Klow, 0.0, _qlow-_w*transition, _qlow));
+    _trans = _w*transition;
 }
 
 
@@ -260,9 +265,12 @@ void CoordinateLimitForce::computeForce( const SimTK::State& s,
 double CoordinateLimitForce::calcLimitForce( const SimTK::State& s) const
 {
     double q = _coord->getValue(s);
-    SimTK::Vector qv(1,q);
-    double K_up = _upStep->calcValue(qv);
-    double K_low = _loStep->calcValue(qv);
+    // Transition from no stiffness to the upperStiffness as coordinate
+    // increases beyond the upper limit
+    double K_up = smoothStep(0.0, _Kup, _qup, _qup + _trans, q);
+    // Transition from lowerStiffness to zero as coordinate increases to the
+    // lower limit
+    double K_low = smoothStep(_Klow, 0.0, _qlow - _trans, _qlow, q);
 
     double qdot = _coord->getSpeedValue(s);
     double f_up = -K_up*(q - _qup);
@@ -286,7 +294,6 @@ double CoordinateLimitForce::calcLimitForce( const SimTK::State& s) const
 double CoordinateLimitForce::computePotentialEnergy(const SimTK::State& s) const
 {
     double q = _coord->getValue(s);
-    SimTK::Vector qv(1,q);
 
     double K=0;
     double delta = 0;
@@ -303,7 +310,7 @@ double CoordinateLimitForce::computePotentialEnergy(const SimTK::State& s) const
         return 0.0;
     }
     
-    const double &trans = _w*get_transition();
+    const double &trans = _trans;
 
     if(delta >= trans){
         // = 5/14*K*trans^2 - 1/2*K*trans^2 + 1/2*K*(delta)^2
@@ -229,16 +229,13 @@ private:
     // Model Component Interface when computing energy
     void computeStateVariableDerivatives(const SimTK::State& s) const override;
 
-    // Smooth step functions for continuous transition from no stiffness and 
-    // damping to constant values beyond the limits. These are heap allocated
-    // and owned here, but we don't want these functions to be copied if a
-    // CoordinateLimitForce is copied.
-    SimTK::ResetOnCopy<std::unique_ptr<SimTK::Function::Step> > _upStep;
-    SimTK::ResetOnCopy<std::unique_ptr<SimTK::Function::Step> > _loStep;
-
     // Scaling for coordinate values in m or degrees (rotational) 
     double _w;
 
+    // Width of the smooth transition from no stiffness and damping to
+    // constant values beyond the limits, in internal (SI) units (m or rad)
+    double _trans;
+
     // Coordinate limits in internal (SI) units (m or rad)
     double _qup;
     double _qlow;
@@ -180,12 +180,12 @@ SimTK::Vec6 FunctionBasedBushingForce::
     Vec6 dq = computeDeflection(s);
 
     Vec6 fk = Vec6(0.0);
-    fk[0] = get_m_x_theta_x_function().calcValue(SimTK::Vector(1, dq[0]));
-    fk[1] = get_m_y_theta_y_function().calcValue(SimTK::Vector(1, dq[1]));
-    fk[2] = get_m_z_theta_z_function().calcValue(SimTK::Vector(1, dq[2]));
-    fk[3] = get_f_x_delta_x_function().calcValue(SimTK::Vector(1, dq[3]));
-    fk[4] = get_f_y_delta_y_function().calcValue(SimTK::Vector(1, dq[4]));
-    fk[5] = get_f_z_delta_z_function().calcValue(SimTK::Vector(1, dq[5]));
+    fk[0] = get_m_x_theta_x_function().calcValueAndDerivatives(dq[0], 0)[0];
+    fk[1] = get_m_y_theta_y_function().calcValueAndDerivatives(dq[1], 0)[0];
+    fk[2] = get_m_z_theta_z_function().calcValueAndDerivatives(dq[2], 0)[0];
+    fk[3] = get_f_x_delta_x_function().calcValueAndDerivatives(dq[3], 0)[0];
+    fk[4] = get_f_y_delta_y_function().calcValueAndDerivatives(dq[4], 0)[0];
+    fk[5] = get_f_z_delta_z_function().calcValueAndDerivatives(dq[5], 0)[0];
 
     return -fk;
 }
@@ -27,6 +27,7 @@
 #include <fstream>
 #include "Frame.h"
 #include "Geometry.h"
+#include "MeshFileCache.h"
 #include "Model.h"
 //=============================================================================
 // STATICS
@@ -219,107 +220,100 @@ void FrameGeometry::implementCreateDecorativeGeometry(SimTK::Array_<SimTK::Decor
 void Mesh::extendFinalizeFromProperties() {
 
     if (!isObjectUpToDateWithProperties()) {
-        const Component* rootModel = nullptr;
-        if (!hasOwner()) {
-            log_error("Mesh {} not connected to model...ignoring",
-                    get_mesh_file());
-            return;   // Orphan Mesh not part of a model yet
-        }
-        const Component* owner = &getOwner();
-        while (owner != nullptr) {
-            if (dynamic_cast<const Model*>(owner) != nullptr) {
-                rootModel = owner;
-                break;
-            }
-            if (owner->hasOwner())
-                owner = &(owner->getOwner()); // traverse up Component tree
-            else
-                break; // can't traverse up.
-        }
+        // The mesh file is found and loaded when it is first needed.
+        cachedMesh.reset();
+        meshLoadAttempted = false;
+    }
+}
 
-        if (rootModel == nullptr) {
-            log_error("Mesh {} not connected to model...ignoring",
-                    get_mesh_file());
-            return;   // Orphan Mesh not descendant of a model
-        }
+void Mesh::loadMesh() const {
+    meshLoadAttempted = true;
 
-        // Current interface to Visualizer calls generateDecorations on every
-        // frame. On first time through, load file and create DecorativeMeshFile
-        // and cache it so we don't load files from disk during live rendering.
-        const Model* mdl = dynamic_cast<const Model*>(rootModel);
-        const std::string& file = get_mesh_file();
-        if (file.empty() || file.compare(PropertyStr::getDefaultStr()) == 0 ||
-            !mdl->getDisplayHints().isVisualizationEnabled())
-            return;  // Return immediately if no file has been specified
-                     // or display is disabled altogether.
-
-        bool isAbsolutePath; string directory, fileName, extension;
-        SimTK::Pathname::deconstructPathname(file,
-            isAbsolutePath, directory, fileName, extension);
-        const string lowerExtension = SimTK::String::toLower(extension);
-        if (lowerExtension != ".vtp" && lowerExtension != ".obj" && lowerExtension != ".stl") {
-            log_error("ModelVisualizer ignoring '{}'; only .vtp, .stl, and "
-                      ".obj files currently supported.",
-                    file);
-            return;
+    const Component* rootModel = nullptr;
+    if (!hasOwner()) {
+        log_error("Mesh {} not connected to model...ignoring",
+                get_mesh_file());
+        return;   // Orphan Mesh not part of a model yet
+    }
+    const Component* owner = &getOwner();
+    while (owner != nullptr) {
+        if (dynamic_cast<const Model*>(owner) != nullptr) {
+            rootModel = owner;
+            break;
         }
+        if (owner->hasOwner())
+            owner = &(owner->getOwner()); // traverse up Component tree
+        else
+            break; // can't traverse up.
+    }
 
-        // File is a .vtp, .stl, or .obj; attempt to find it.
-        Array_<string> attempts;
-        const Model& model = dynamic_cast<const Model&>(*rootModel);
-        bool foundIt = ModelVisualizer::findGeometryFile(model, file, isAbsolutePath, attempts);
-
-        if (!foundIt) {
-            if (!warningGiven) {
-                log_warn("Couldn't find file '{}'.", file);
-                warningGiven = true;
-            }
-            
-            log_debug( "The following locations were tried:");
-            for (unsigned i = 0; i < attempts.size(); ++i)
-                log_debug(attempts[i]);
-            
-            if (!isAbsolutePath &&
-                !Pathname::environmentVariableExists("OPENSIM_HOME"))
-                log_debug("Set environment variable OPENSIM_HOME to search $OPENSIM_HOME/Geometry.");
-            return;
-        }
+    if (rootModel == nullptr) {
+        log_error("Mesh {} not connected to model...ignoring",
+                get_mesh_file());
+        return;   // Orphan Mesh not descendant of a model
+    }
 
-        try {
-            std::ifstream objFile;
-            objFile.open(attempts.back().c_str());
-            // objFile closes when destructed
-            // if the file can be opened but had bad contents e.g. binary vtp 
-            // it will be handled downstream 
-        }
-        catch (const std::exception& e) {
-            log_warn("Visualizer couldn't open {} because: {}",
-                attempts.back(), e.what());
-            return;
+    // Current interface to Visualizer calls generateDecorations on every
+    // frame. On first time through, load file and create DecorativeMeshFile
+    // and cache it so we don't load files from disk during live rendering.
+    const Model* mdl = dynamic_cast<const Model*>(rootModel);
+    const std::string& file = get_mesh_file();
+    if (file.empty() || file.compare(PropertyStr::getDefaultStr()) == 0 ||
+        !mdl->getDisplayHints().isVisualizationEnabled())
+        return;  // Return immediately if no file has been specified
+                 // or display is disabled altogether.
+
+    bool isAbsolutePath; string directory, fileName, extension;
+    SimTK::Pathname::deconstructPathname(file,
+        isAbsolutePath, directory, fileName, extension);
+    const string lowerExtension = SimTK::String::toLower(extension);
+    if (lowerExtension != ".vtp" && lowerExtension != ".obj" && lowerExtension != ".stl") {
+        log_error("ModelVisualizer ignoring '{}'; only .vtp, .stl, and "
+                  ".obj files currently supported.",
+                file);
+        return;
+    }
+
+    // File is a .vtp, .stl, or .obj; attempt to find it.
+    Array_<string> attempts;
+    const Model& model = dynamic_cast<const Model&>(*rootModel);
+    bool foundIt = ModelVisualizer::findGeometryFile(model, file, isAbsolutePath, attempts);
+
+    if (!foundIt) {
+        if (!warningGiven) {
+            log_warn("Couldn't find file '{}'.", file);
+            warningGiven = true;
         }
+        
+        log_debug( "The following locations were tried:");
+        for (unsigned i = 0; i < attempts.size(); ++i)
+            log_debug(attempts[i]);
+        
+        if (!isAbsolutePath &&
+            !Pathname::environmentVariableExists("OPENSIM_HOME"))
+            log_debug("Set environment variable OPENSIM_HOME to search $OPENSIM_HOME/Geometry.");
+        return;
+    }
 
-        cachedMesh.reset(new DecorativeMeshFile(attempts.back().c_str()));
+    try {
+        // Reading the mesh also detects bad contents (e.g., binary vtp).
+        cachedMesh = MeshFileCache::load(attempts.back());
+    }
+    catch (const std::exception& e) {
+        log_warn("Visualizer couldn't open {} because: {}",
+            attempts.back(), e.what());
+        // No longer try to visualize this mesh.
+        cachedMesh.reset();
     }
 }
 
 
 void Mesh::implementCreateDecorativeGeometry(SimTK::Array_<SimTK::DecorativeGeometry>& decoGeoms) const
 {
+    if (!meshLoadAttempted) loadMesh();
     if (cachedMesh.get() != nullptr) {
-        try {
-            // Force the loading of the mesh to see if it has bad contents
-            // (e.g., binary vtp).
-            // We do not want to do this in extendFinalizeFromProperties b/c
-            // it's expensive to repeatedly load meshes.
-            cachedMesh->getMesh();
-        } catch (const std::exception& e) {
-            log_warn("Visualizer couldn't open {} because: {}",
-                get_mesh_file(), e.what());
-            // No longer try to visualize this mesh.
-            cachedMesh.reset();
-            return;
-        }
-        cachedMesh->setScaleFactors(get_scale_factors());
-        decoGeoms.push_back(*cachedMesh);
+        SimTK::DecorativeMeshFile deco(*cachedMesh);
+        deco.setScaleFactors(get_scale_factors());
+        decoGeoms.push_back(deco);
     }
 }
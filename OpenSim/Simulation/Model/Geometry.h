@@ -560,6 +560,7 @@ public:
     Mesh() :
         Geometry(),
         cachedMesh(nullptr),
+        meshLoadAttempted(false),
         warningGiven(false)
     {
         constructProperty_mesh_file("");
@@ -568,6 +569,7 @@ public:
     Mesh(const std::string& geomFile) :
         Geometry(),
         cachedMesh(nullptr),
+        meshLoadAttempted(false),
         warningGiven(false)
     {
         constructProperty_mesh_file("");
@@ -589,10 +591,19 @@ protected:
     void implementCreateDecorativeGeometry(
         SimTK::Array_<SimTK::DecorativeGeometry>& decoGeoms) const override;
 private:
+    // Find the mesh file and get its mesh from the MeshFileCache. This is
+    // done the first time decorations are created rather than in
+    // extendFinalizeFromProperties(), so that models that are never
+    // visualized do not search for or read their mesh files.
+    void loadMesh() const;
+
     // We cache the DecorativeMeshFile if we successfully
     // load the mesh from file so we don't try loading from disk every frame.
+    // The mesh is shared with other Meshes that use the same file.
     // This is mutable since it is not part of the public interface.
-    mutable SimTK::ResetOnCopy<std::unique_ptr<SimTK::DecorativeMeshFile>> cachedMesh;
+    mutable SimTK::ResetOnCopy<std::shared_ptr<const SimTK::DecorativeMeshFile>>
+        cachedMesh;
+    mutable bool meshLoadAttempted;
     mutable bool warningGiven;
 };
 
@@ -0,0 +1,79 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  MeshFileCache.cpp                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2022 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MeshFileCache.h"
+
+#include "SimTKcommon/internal/Pathname.h"
+
+#include <mutex>
+#include <unordered_map>
+
+using namespace OpenSim;
+
+namespace {
+std::mutex& getMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+// The meshes, by absolute path. Expired entries are removed when the cache
+// is searched.
+std::unordered_map<std::string, std::weak_ptr<const SimTK::DecorativeMeshFile>>&
+getMeshes() {
+    static std::unordered_map<std::string,
+            std::weak_ptr<const SimTK::DecorativeMeshFile>> meshes;
+    return meshes;
+}
+} // anonymous namespace
+
+std::shared_ptr<const SimTK::DecorativeMeshFile> MeshFileCache::load(
+        const std::string& fileName) {
+    const std::string path = SimTK::Pathname::getAbsolutePathname(fileName);
+    {
+        std::lock_guard<std::mutex> lock(getMutex());
+        auto it = getMeshes().find(path);
+        if (it != getMeshes().end()) {
+            if (auto mesh = it->second.lock()) return mesh;
+            getMeshes().erase(it);
+        }
+    }
+
+    // Read the file without holding the lock, so that other files can be
+    // read at the same time. If another thread reads the same file
+    // meanwhile, the mesh that was cached first is used.
+    auto mesh = std::make_shared<SimTK::DecorativeMeshFile>(path);
+    mesh->getMesh();
+
+    std::lock_guard<std::mutex> lock(getMutex());
+    auto& cached = getMeshes()[path];
+    if (auto existing = cached.lock()) return existing;
+    cached = mesh;
+    return mesh;
+}
+
+int MeshFileCache::getNumMeshes() {
+    std::lock_guard<std::mutex> lock(getMutex());
+    int numMeshes = 0;
+    for (const auto& entry : getMeshes()) {
+        if (!entry.second.expired()) ++numMeshes;
+    }
+    return numMeshes;
+}
@@ -0,0 +1,58 @@
+#ifndef OPENSIM_MESH_FILE_CACHE_H_
+#define OPENSIM_MESH_FILE_CACHE_H_
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  MeshFileCache.h                          *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2022 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+#include "SimTKcommon/internal/DecorativeGeometry.h"
+
+#include <memory>
+#include <string>
+
+namespace OpenSim {
+
+/** A process-wide cache of the meshes read from geometry files (.vtp, .obj,
+.stl). Mesh and ContactMesh components get their meshes from this cache, so
+that a model, its copies, and any other models in the process that use the
+same file share a single copy of the mesh instead of each reading the file.
+
+Meshes are keyed by the absolute path of the file. The cache only holds
+weak references: a mesh is released once no component uses it, and the file
+is read again the next time it is requested. The cache may be used from
+multiple threads. */
+class OSIMSIMULATION_API MeshFileCache {
+public:
+    /** Get the mesh in the given file, reading the file if the mesh is not
+    already in use. A relative path is relative to the current working
+    directory. The mesh of the returned DecorativeMeshFile has already been
+    loaded (getMesh() does not read the file again), and copies of it share
+    that mesh. This throws an exception if the file cannot be read. */
+    static std::shared_ptr<const SimTK::DecorativeMeshFile> load(
+            const std::string& fileName);
+
+    /** The number of meshes that are currently in use. */
+    static int getNumMeshes();
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MESH_FILE_CACHE_H_
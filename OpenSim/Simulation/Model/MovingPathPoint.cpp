@@ -213,105 +213,88 @@ void MovingPathPoint::updateFromXMLNode(SimTK::Xml::Element& aNode, int versionN
     Super::updateFromXMLNode(aNode, versionNumber);
 }
 
-SimTK::Vec3 MovingPathPoint::getLocation(const SimTK::State& s) const
+void MovingPathPoint::extendAddToSystem(SimTK::MultibodySystem& system) const
 {
-    SimTK::Vec3 pInF(0);
-    if (!_xCoordinate.empty()) {
-        const double xval = SimTK::clamp(_xCoordinate->getRangeMin(),
-            _xCoordinate->getValue(s),
+    Super::extendAddToSystem(system);
+    this->_locationInfoCV = addCacheVariable("location_info",
+            LocationInfo(), SimTK::Stage::Position);
+}
+
+MovingPathPoint::LocationInfo
+MovingPathPoint::calcLocationInfo(const SimTK::State& s) const
+{
+    // extendConnectToModel() ensures that all components of the location
+    // depend on the same Coordinate (if any), so its value is obtained once.
+    const Function* functions[3] = {&get_x_location(), &get_y_location(),
+            &get_z_location()};
+    LocationInfo info;
+    if (_xCoordinate.empty()) {
+        // Each function is a Constant.
+        for (int i = 0; i < 3; ++i) {
+            info.location[i] =
+                    functions[i]->calcValueAndDerivatives(0.0, 0)[0];
+        }
+        return info;
+    }
+
+    // The location is evaluated with the value clamped to the Coordinate's
+    // range, but the derivative is evaluated at the actual value.
+    const double value = _xCoordinate->getValue(s);
+    const double clamped = SimTK::clamp(_xCoordinate->getRangeMin(), value,
             _xCoordinate->getRangeMax());
-        pInF[0] = get_x_location().calcValue(SimTK::Vector(1, xval));
+    for (int i = 0; i < 3; ++i) {
+        const Vec3 result = functions[i]->calcValueAndDerivatives(value, 1);
+        info.dPdq[i] = result[1];
+        info.location[i] = (clamped == value) ? result[0] :
+                functions[i]->calcValueAndDerivatives(clamped, 0)[0];
     }
-    else // assume a Constant
-        pInF[0] = get_x_location().calcValue(SimTK::Vector(1, 0.0));
+    return info;
+}
 
-    if (!_yCoordinate.empty()) {
-        const double yval = SimTK::clamp(_yCoordinate->getRangeMin(),
-            _yCoordinate->getValue(s),
-            _yCoordinate->getRangeMax());
-        pInF[1] = get_y_location().calcValue(SimTK::Vector(1, yval));
+MovingPathPoint::LocationInfo
+MovingPathPoint::getLocationInfo(const SimTK::State& s) const
+{
+    // The cache variable cannot be used until the Coordinate values are
+    // available in the state.
+    if (s.getSystemStage() < SimTK::Stage::Time) {
+        return calcLocationInfo(s);
     }
-    else // type == Constant
-        pInF[1] = get_y_location().calcValue(SimTK::Vector(1, 0.0));
 
-    if (!_zCoordinate.empty()) {
-        const double zval = SimTK::clamp(_zCoordinate->getRangeMin(),
-            _zCoordinate->getValue(s),
-            _zCoordinate->getRangeMax());
-        pInF[2] = get_z_location().calcValue(SimTK::Vector(1, zval));
+    if (isCacheVariableValid(s, _locationInfoCV)) {
+        return getCacheVariableValue(s, _locationInfoCV);
     }
-    else // type == Constant
-        pInF[2] = get_z_location().calcValue(SimTK::Vector(1, 0.0));
 
-    return pInF;
-}
+    LocationInfo& info = updCacheVariableValue(s, _locationInfoCV);
+    info = calcLocationInfo(s);
+    markCacheVariableValid(s, _locationInfoCV);
 
+    return info;
+}
 
-SimTK::Vec3 MovingPathPoint::getVelocity(const SimTK::State& s) const
+SimTK::Vec3 MovingPathPoint::getLocation(const SimTK::State& s) const
 {
-    std::vector<int> derivComponents;
-    derivComponents.push_back(0);
+    return getLocationInfo(s).location;
+}
 
-    SimTK::Vec3 vInF(0);
 
-    if (!_xCoordinate.empty()){
-        //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        vInF[0] = get_x_location().calcDerivative(
-            derivComponents, SimTK::Vector(1, _xCoordinate->getValue(s)))*
-                _xCoordinate->getSpeedValue(s);
-    }
-    else
-        vInF[0] = 0.0;
-
-    if (!_yCoordinate.empty()){
-        //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        vInF[1] = get_y_location().calcDerivative(
-            derivComponents, SimTK::Vector(1, _yCoordinate->getValue(s)))*
-                _yCoordinate->getSpeedValue(s);
-    }
-    else
-        vInF[1] = 0.0;
-
-    if (!_zCoordinate.empty()){
-        //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        vInF[2] = get_z_location().calcDerivative(
-            derivComponents, SimTK::Vector(1, _zCoordinate->getValue(s)))*
-                _zCoordinate->getSpeedValue(s);
+SimTK::Vec3 MovingPathPoint::getVelocity(const SimTK::State& s) const
+{
+    if (_xCoordinate.empty()) {
+        return Vec3(0);
     }
-    else
-        vInF[2] = 0.0;
-
-    return vInF;
+    // Multiply the partial (derivative of point location w.r.t. gencoord) by
+    // genspeed.
+    return getLocationInfo(s).dPdq * _xCoordinate->getSpeedValue(s);
 }
 
 //_____________________________________________________________________________
 /*
- * Get the velocity of the point in the body's local reference frame.
+ * Get the derivative of the point's location in its frame with respect to
+ * the coordinate.
  */
 SimTK::Vec3 MovingPathPoint::getdPointdQ(const SimTK::State& s) const
 {
-    SimTK::Vec3 dPdq_B(0);
-
-    std::vector<int> derivComponents;
-    derivComponents.push_back(0);
-
-    if (!_xCoordinate.empty()){
-        //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        dPdq_B[0] = get_x_location().calcDerivative(derivComponents, 
-            SimTK::Vector(1, _xCoordinate->getValue(s)));
-    }
-    if (!_yCoordinate.empty()){
-        //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        dPdq_B[1] = get_y_location().calcDerivative(derivComponents,
-            SimTK::Vector(1, _yCoordinate->getValue(s)));
-    }
-    if (!_zCoordinate.empty()){
-        //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        dPdq_B[2] = get_z_location().calcDerivative(derivComponents,
-            SimTK::Vector(1, _zCoordinate->getValue(s)));
-    }
-
-    return dPdq_B;
+    return getLocationInfo(s).dPdq;
 }
 
 void MovingPathPoint::
@@ -112,8 +112,27 @@ public:
     void extendScale(const SimTK::State& s, const ScaleSet& scaleSet) override;
 
 private:
+    /** The location of the point in its Frame and the derivative of the
+        location with respect to the Coordinate, which depend only on the
+        Coordinate's value. These are computed together and cached, since
+        GeometryPath needs both for the path's length, lengthening speed, and
+        moment arms. */
+    struct LocationInfo {
+        SimTK::Vec3 location{0};
+        SimTK::Vec3 dPdq{0};
+        friend std::ostream& operator<<(std::ostream& o,
+                const LocationInfo& info) {
+            return o << "MovingPathPoint::LocationInfo: location="
+                     << info.location << " dPdq=" << info.dPdq;
+        }
+    };
+
     void constructProperties();
     void extendConnectToModel(Model& model) override;
+    void extendAddToSystem(SimTK::MultibodySystem& system) const override;
+
+    LocationInfo calcLocationInfo(const SimTK::State& s) const;
+    LocationInfo getLocationInfo(const SimTK::State& s) const;
 
     SimTK::Vec3 calcLocationInGround(const SimTK::State& state) const override;
     SimTK::Vec3 calcVelocityInGround(const SimTK::State& state) const override;
@@ -124,6 +143,8 @@ private:
     SimTK::ReferencePtr<const Coordinate> _yCoordinate;
     SimTK::ReferencePtr<const Coordinate> _zCoordinate;
 
+    mutable CacheVariable<LocationInfo> _locationInfoCV;
+
 //=============================================================================
 };  // END of class MovingPathPoint
 //=============================================================================
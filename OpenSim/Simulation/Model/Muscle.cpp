@@ -201,6 +201,11 @@ void Muscle::extendConnectToModel(Model& aModel)
 {
     Super::extendConnectToModel(aModel);
 
+    updateMuscleQuantitiesFromProperties();
+}
+
+void Muscle::updateMuscleQuantitiesFromProperties()
+{
     _muscleWidth = getOptimalFiberLength()
                     * sin(getPennationAngleAtOptimalFiberLength());
 
@@ -435,6 +435,11 @@ protected:
     muscle path based on activation. **/
     SimTK::Vec3 computePathColor(const SimTK::State& state) const override;
     
+    /** Update the copies of the muscle's properties that are cached when it
+    is connected to the model (e.g., _maxIsometricForce, _muscleWidth) after
+    one of those properties has been edited. */
+    void updateMuscleQuantitiesFromProperties();
+
     /** Model Component creation interface */
     void extendConnectToModel(Model& aModel) override;
     void extendAddToSystem(SimTK::MultibodySystem& system) const override;
@@ -52,30 +52,12 @@ void SmoothSphereHalfSpaceForce::extendAddToSystem(
 
     Super::extendAddToSystem(system);
 
-    double stiffness = get_stiffness();
-    double dissipation = get_dissipation();
-    double staticFriction = get_static_friction();
-    double dynamicFriction = get_dynamic_friction();
-    double viscousFriction = get_viscous_friction();
-    double transitionVelocity = get_transition_velocity();
-    double cf = get_constant_contact_force();
-    double bd = get_hertz_smoothing();
-    double bv = get_hunt_crossley_smoothing();
-
     SimTK::SmoothSphereHalfSpaceForce force(_model->updForceSubsystem());
 
     const auto& sphere = getConnectee<ContactSphere>("sphere");
     const auto& halfSpace = getConnectee<ContactHalfSpace>("half_space");
 
-    force.setStiffness(stiffness);
-    force.setDissipation(dissipation);
-    force.setStaticFriction(staticFriction);
-    force.setDynamicFriction(dynamicFriction);
-    force.setViscousFriction(viscousFriction);
-    force.setTransitionVelocity(transitionVelocity);
-    force.setConstantContactForce(cf);
-    force.setHertzSmoothing(bd);
-    force.setHuntCrossleySmoothing(bv);
+    applyContactParameters(force);
 
     force.setContactSphereBody(sphere.getFrame().getMobilizedBody());
     force.setContactSphereLocationInBody(
@@ -93,6 +75,26 @@ void SmoothSphereHalfSpaceForce::extendAddToSystem(
     mutableThis->_index = force.getForceIndex();
 }
 
+void SmoothSphereHalfSpaceForce::applyContactParameters(
+        SimTK::SmoothSphereHalfSpaceForce& force) const {
+    force.setStiffness(get_stiffness());
+    force.setDissipation(get_dissipation());
+    force.setStaticFriction(get_static_friction());
+    force.setDynamicFriction(get_dynamic_friction());
+    force.setViscousFriction(get_viscous_friction());
+    force.setTransitionVelocity(get_transition_velocity());
+    force.setConstantContactForce(get_constant_contact_force());
+    force.setHertzSmoothing(get_hertz_smoothing());
+    force.setHuntCrossleySmoothing(get_hunt_crossley_smoothing());
+}
+
+void SmoothSphereHalfSpaceForce::updateContactParametersInSystem() {
+    OPENSIM_THROW_IF_FRMOBJ(!hasSystem(), ComponentHasNoSystem);
+    auto& force = static_cast<SimTK::SmoothSphereHalfSpaceForce&>(
+            _model->updForceSubsystem().updForce(_index));
+    applyContactParameters(force);
+}
+
 void OpenSim::SmoothSphereHalfSpaceForce::extendRealizeInstance(
         const SimTK::State& state) const {
     Super::extendRealizeInstance(state);
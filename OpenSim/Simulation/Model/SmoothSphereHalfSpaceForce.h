@@ -24,6 +24,8 @@
 #include "ContactSphere.h"
 #include <OpenSim/Common/Set.h>
 
+namespace SimTK { class SmoothSphereHalfSpaceForce; }
+
 namespace OpenSim {
 
 /** This compliant contact force model is similar to HuntCrossleyForce, except
@@ -126,6 +128,12 @@ public:
             const ContactSphere& contactSphere,
             const ContactHalfSpace& contactHalfSpace);
 
+    /// Push the current values of the contact parameter properties (stiffness
+    /// through hunt_crossley_smoothing) into the SimTK::Force of an existing
+    /// System, without rebuilding the System. Model::initializeState() must
+    /// be invoked before the new values take effect.
+    void updateContactParametersInSystem();
+
     //=========================================================================
     // REPORTING
     //=========================================================================
@@ -151,6 +159,7 @@ protected:
 private:
     // INITIALIZATION
     void constructProperties();
+    void applyContactParameters(SimTK::SmoothSphereHalfSpaceForce& force) const;
     mutable double m_forceVizScaleFactor;
 
 //=============================================================================
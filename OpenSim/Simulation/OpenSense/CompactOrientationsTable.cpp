@@ -0,0 +1,264 @@
+/* -------------------------------------------------------------------------- *
+ *                       CompactOrientationsTable.cpp                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2022 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+#include "CompactOrientationsTable.h"
+
+#include <OpenSim/Common/Exception.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace OpenSim;
+
+CompactOrientationsTable::CompactOrientationsTable(
+        const TimeSeriesTableQuaternion& table)
+        : m_times(table.getIndependentColumn()),
+          m_labels(table.getColumnLabels()),
+          m_tableMetaData(table.getTableMetaData()),
+          m_dependentsMetaData(table.getDependentsMetaData()) {
+    const auto& matrix = table.getMatrix();
+    const int nr = matrix.nrow();
+    const int nc = matrix.ncol();
+    for (auto& component : m_components) component.resize((size_t)nr * nc);
+    for (int i = 0; i < nr; ++i) {
+        for (int j = 0; j < nc; ++j) {
+            const SimTK::Quaternion& q = matrix.getElt(i, j);
+            const size_t k = (size_t)i * nc + j;
+            m_components[0][k] = q[0];
+            m_components[1][k] = q[1];
+            m_components[2][k] = q[2];
+            m_components[3][k] = q[3];
+        }
+    }
+}
+
+CompactOrientationsTable::CompactOrientationsTable(
+        TimeSeriesTableQuaternion&& table)
+        : CompactOrientationsTable(
+                  static_cast<const TimeSeriesTableQuaternion&>(table)) {
+    table = TimeSeriesTableQuaternion();
+}
+
+SimTK::Quaternion CompactOrientationsTable::getQuaternion(
+        int row, int col) const {
+    const size_t k = (size_t)row * getNumColumns() + col;
+    // The components are already normalized.
+    return SimTK::Quaternion(SimTK::Vec4(m_components[0][k],
+            m_components[1][k], m_components[2][k], m_components[3][k]), true);
+}
+
+void CompactOrientationsTable::rotate(const SimTK::Rotation& rotation) {
+    rotateQuaternions(rotation.convertRotationToQuaternion(),
+            m_components[0].size(), m_components[0].data(),
+            m_components[1].data(), m_components[2].data(),
+            m_components[3].data());
+}
+
+void CompactOrientationsTable::rotateQuaternions(
+        const SimTK::Quaternion& rotation, std::size_t n, double* w,
+        double* x, double* y, double* z) {
+    const double a = rotation[0];
+    const double b = rotation[1];
+    const double c = rotation[2];
+    const double d = rotation[3];
+    for (std::size_t k = 0; k < n; ++k) {
+        // Quaternion product (a, b, c, d) * (w, x, y, z).
+        const double wk = a * w[k] - b * x[k] - c * y[k] - d * z[k];
+        const double xk = a * x[k] + b * w[k] + c * z[k] - d * y[k];
+        const double yk = a * y[k] - b * z[k] + c * w[k] + d * x[k];
+        const double zk = a * z[k] + b * y[k] - c * x[k] + d * w[k];
+        // q and -q are the same rotation; keep the scalar part nonnegative.
+        const double sign = wk < 0 ? -1.0 : 1.0;
+        w[k] = sign * wk;
+        x[k] = sign * xk;
+        y[k] = sign * yk;
+        z[k] = sign * zk;
+    }
+}
+
+namespace {
+// Sum the quaternions in rows [startRow, endRow) of each column, after
+// flipping their signs to agree with the reference orientation `ref` of the
+// column. Orientations whose angle from the reference exceeds the
+// column's maximum angle, if given, are skipped. The column index is the
+// inner loop so that each pass works on contiguous arrays.
+void sumAlignedQuaternions(const double* const* q, int startRow, int endRow,
+        int nc, const std::vector<double>* ref, const double* maxAngle,
+        std::vector<double>* sum) {
+    for (int c = 0; c < 4; ++c) std::fill(sum[c].begin(), sum[c].end(), 0.0);
+    for (int i = startRow; i < endRow; ++i) {
+        const size_t offset = (size_t)i * nc;
+        const double* w = q[0] + offset;
+        const double* x = q[1] + offset;
+        const double* y = q[2] + offset;
+        const double* z = q[3] + offset;
+        for (int j = 0; j < nc; ++j) {
+            const double dot = w[j] * ref[0][j] + x[j] * ref[1][j] +
+                               y[j] * ref[2][j] + z[j] * ref[3][j];
+            // Missing orientations have a NaN dot product.
+            if (std::isnan(dot)) continue;
+            if (maxAngle && !(2 * std::acos(std::min(1.0, std::abs(dot))) <=
+                                     maxAngle[j])) {
+                continue;
+            }
+            const double sign = dot < 0 ? -1.0 : 1.0;
+            sum[0][j] += sign * w[j];
+            sum[1][j] += sign * x[j];
+            sum[2][j] += sign * y[j];
+            sum[3][j] += sign * z[j];
+        }
+    }
+}
+} // anonymous namespace
+
+CompactOrientationsTable CompactOrientationsTable::computeAverageOrientations(
+        int startRow, int numRows) const {
+    OPENSIM_THROW_IF(numRows < 1 || startRow < 0 ||
+                             startRow + numRows > getNumRows(),
+            Exception,
+            "Expected a window of at least 1 row within the " +
+                    std::to_string(getNumRows()) +
+                    " rows of the table, but got " + std::to_string(numRows) +
+                    " rows starting at row " + std::to_string(startRow) + ".");
+    const int nc = getNumColumns();
+    const int endRow = startRow + numRows;
+
+    CompactOrientationsTable average;
+    average.m_times = {m_times[startRow]};
+    average.m_labels = m_labels;
+    average.m_tableMetaData = m_tableMetaData;
+    average.m_dependentsMetaData = m_dependentsMetaData;
+    for (int c = 0; c < 4; ++c) {
+        const auto begin = m_components[c].begin() + (size_t)startRow * nc;
+        average.m_components[c].assign(begin, begin + nc);
+    }
+    if (numRows == 1) return average;
+
+    const double* q[4] = {m_components[0].data(), m_components[1].data(),
+            m_components[2].data(), m_components[3].data()};
+    // The reference for the signs of each column is its first orientation in
+    // the window.
+    std::vector<double> ref[4];
+    for (int c = 0; c < 4; ++c) ref[c] = average.m_components[c];
+    for (int i = startRow + 1; i < endRow; ++i) {
+        for (int j = 0; j < nc; ++j) {
+            if (!std::isnan(ref[0][j])) continue;
+            const size_t k = (size_t)i * nc + j;
+            for (int c = 0; c < 4; ++c) ref[c][j] = q[c][k];
+        }
+    }
+
+    std::vector<double> sum[4];
+    for (auto& component : sum) component.resize(nc);
+    const auto normalize = [&]() {
+        for (int j = 0; j < nc; ++j) {
+            const double norm = std::sqrt(sum[0][j] * sum[0][j] +
+                                          sum[1][j] * sum[1][j] +
+                                          sum[2][j] * sum[2][j] +
+                                          sum[3][j] * sum[3][j]);
+            // Keep the scalar part nonnegative; a column without orientations
+            // has a zero sum and becomes NaN.
+            const double scale =
+                    norm == 0 ? SimTK::NaN
+                              : (sum[0][j] < 0 ? -1.0 : 1.0) / norm;
+            for (int c = 0; c < 4; ++c) sum[c][j] *= scale;
+        }
+    };
+
+    // First average of all orientations in the window.
+    sumAlignedQuaternions(q, startRow, endRow, nc, ref, nullptr, sum);
+    normalize();
+    for (int c = 0; c < 4; ++c) ref[c] = sum[c];
+
+    // Exclude the outliers: orientations more than 3 times the median angle
+    // from the first average.
+    std::vector<double> maxAngle(nc, SimTK::NaN);
+    std::vector<double> angles;
+    angles.reserve(numRows);
+    for (int j = 0; j < nc; ++j) {
+        angles.clear();
+        for (int i = startRow; i < endRow; ++i) {
+            const size_t k = (size_t)i * nc + j;
+            const double dot = q[0][k] * ref[0][j] + q[1][k] * ref[1][j] +
+                               q[2][k] * ref[2][j] + q[3][k] * ref[3][j];
+            if (std::isnan(dot)) continue;
+            angles.push_back(2 * std::acos(std::min(1.0, std::abs(dot))));
+        }
+        if (angles.empty()) continue;
+        auto median = angles.begin() + angles.size() / 2;
+        std::nth_element(angles.begin(), median, angles.end());
+        maxAngle[j] = 3 * *median;
+    }
+    sumAlignedQuaternions(q, startRow, endRow, nc, ref, maxAngle.data(), sum);
+    normalize();
+    for (int c = 0; c < 4; ++c) average.m_components[c] = sum[c];
+    return average;
+}
+
+TimeSeriesTableQuaternion
+CompactOrientationsTable::convertToQuaternionsTable() const {
+    const int nr = getNumRows();
+    const int nc = getNumColumns();
+    SimTK::Matrix_<SimTK::Quaternion> matrix(nr, nc);
+    for (int i = 0; i < nr; ++i) {
+        for (int j = 0; j < nc; ++j) {
+            matrix.updElt(i, j) = getQuaternion(i, j);
+        }
+    }
+    TimeSeriesTableQuaternion table(m_times, matrix, m_labels);
+    table.updTableMetaData() = m_tableMetaData;
+    table.setDependentsMetaData(m_dependentsMetaData);
+    return table;
+}
+
+TimeSeriesTable_<SimTK::Rotation>
+CompactOrientationsTable::convertToRotationsTable() const {
+    const int nr = getNumRows();
+    const int nc = getNumColumns();
+    const double* w = m_components[0].data();
+    const double* x = m_components[1].data();
+    const double* y = m_components[2].data();
+    const double* z = m_components[3].data();
+    SimTK::Matrix_<SimTK::Rotation> matrix(nr, nc);
+    for (int i = 0; i < nr; ++i) {
+        for (int j = 0; j < nc; ++j) {
+            const size_t k = (size_t)i * nc + j;
+            // Same as SimTK::Rotation::setRotationFromQuaternion() for a unit
+            // quaternion.
+            const double ww = w[k] * w[k], xx = x[k] * x[k],
+                         yy = y[k] * y[k], zz = z[k] * z[k];
+            const double wx = w[k] * x[k], wy = w[k] * y[k],
+                         wz = w[k] * z[k];
+            const double xy = x[k] * y[k], xz = x[k] * z[k],
+                         yz = y[k] * z[k];
+            const SimTK::Mat33 R(ww + xx - yy - zz, 2 * (xy - wz),
+                    2 * (xz + wy), 2 * (xy + wz), ww - xx + yy - zz,
+                    2 * (yz - wx), 2 * (xz - wy), 2 * (yz + wx),
+                    ww - xx - yy + zz);
+            // The matrix is already orthonormal.
+            matrix.updElt(i, j) = SimTK::Rotation(R, true);
+        }
+    }
+    TimeSeriesTable_<SimTK::Rotation> table(m_times, matrix, m_labels);
+    table.updTableMetaData() = m_tableMetaData;
+    table.setDependentsMetaData(m_dependentsMetaData);
+    return table;
+}
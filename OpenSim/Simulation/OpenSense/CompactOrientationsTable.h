@@ -0,0 +1,119 @@
+#ifndef OPENSENSE_COMPACT_ORIENTATIONS_TABLE_H_
+#define OPENSENSE_COMPACT_ORIENTATIONS_TABLE_H_
+/* -------------------------------------------------------------------------- *
+ *                        CompactOrientationsTable.h                          *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2022 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+#include <OpenSim/Common/TimeSeriesTable.h>
+
+#include <array>
+#include <vector>
+
+namespace OpenSim {
+
+/** The orientations of a set of sensors (e.g., IMUs) over time, stored as
+unit quaternions in a structure-of-arrays layout: each of the four quaternion
+components (w, x, y, z) of all elements is in its own contiguous array, in
+row-major order (the element in row `i` and column `j` is at index
+`i * getNumColumns() + j`).
+
+This takes 4 doubles per element, compared to 9 for a table of
+SimTK::Rotation, and lets the bulk operations of the OpenSense pipeline
+(rotating all orientations into the OpenSim frame, applying the heading
+correction, and converting to rotation matrices for an OrientationsReference)
+run as simple loops over contiguous arrays that the compiler can vectorize.
+
+Rotated quaternions are normalized to have a nonnegative scalar part w, like
+those from SimTK::Rotation::convertRotationToQuaternion(). Missing (NaN)
+orientations remain NaN. */
+class OSIMSIMULATION_API CompactOrientationsTable {
+public:
+    CompactOrientationsTable() = default;
+    /** Copy the times, column labels, metadata and orientations of a table
+    of quaternions. */
+    explicit CompactOrientationsTable(const TimeSeriesTableQuaternion& table);
+    /** Same as above, but the table is emptied once its orientations have
+    been copied, so that a caller that no longer needs the table does not
+    keep both copies of the orientations. */
+    explicit CompactOrientationsTable(TimeSeriesTableQuaternion&& table);
+
+    int getNumRows() const { return (int)m_times.size(); }
+    int getNumColumns() const { return (int)m_labels.size(); }
+    const std::vector<double>& getIndependentColumn() const { return m_times; }
+    const std::vector<std::string>& getColumnLabels() const { return m_labels; }
+
+    /** The orientation in row `row` and column `col`. */
+    SimTK::Quaternion getQuaternion(int row, int col) const;
+    /** The values of quaternion component `component` (0 for w, 1-3 for x, y,
+    z) of all elements, in row-major order. */
+    const double* getComponentData(int component) const {
+        return m_components[component].data();
+    }
+
+    /** Rotate every orientation by `rotation` (i.e., R_XG * R for each
+    orientation R). This is used to express the orientations in the OpenSim
+    ground frame and to apply the heading correction. */
+    void rotate(const SimTK::Rotation& rotation);
+
+    /** Average the orientations in the `numRows` rows starting at row
+    `startRow`, separately for each column, and return them as a table with a
+    single row at the time of `startRow`. The quaternions are averaged after
+    flipping their signs to agree with the first orientation in the window;
+    the average is then recomputed without the orientations that are more than
+    3 times the median angle away from it (e.g., frames in which the subject
+    moved). Missing (NaN) orientations are ignored, and a column with no
+    orientations in the window remains NaN. With a single row, the orientations
+    are copied unchanged. All columns are averaged together in each pass over
+    the rows. */
+    CompactOrientationsTable computeAverageOrientations(
+            int startRow, int numRows) const;
+
+    /** Create a table of quaternions with the same times, labels and
+    metadata. */
+    TimeSeriesTableQuaternion convertToQuaternionsTable() const;
+    /** Create a table of rotation matrices with the same times, labels and
+    metadata, for use by an OrientationsReference. */
+    TimeSeriesTable_<SimTK::Rotation> convertToRotationsTable() const;
+
+    /** The number of bytes used by the orientations (not including the times
+    and labels). */
+    std::size_t getNumBytesOfOrientations() const {
+        return 4 * m_components[0].size() * sizeof(double);
+    }
+
+    /** Compute `rotation * q` for `n` quaternions whose components are in the
+    given arrays, in place. The results are normalized to have a nonnegative
+    scalar part. */
+    static void rotateQuaternions(const SimTK::Quaternion& rotation,
+            std::size_t n, double* w, double* x, double* y, double* z);
+
+private:
+    std::vector<double> m_times;
+    std::vector<std::string> m_labels;
+    TimeSeriesTableQuaternion::TableMetaData m_tableMetaData;
+    TimeSeriesTableQuaternion::DependentsMetaData m_dependentsMetaData;
+    std::array<std::vector<double>, 4> m_components;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSENSE_COMPACT_ORIENTATIONS_TABLE_H_
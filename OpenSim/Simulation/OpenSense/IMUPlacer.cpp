@@ -72,6 +72,7 @@ void IMUPlacer::constructProperties() {
     constructProperty_sensor_to_opensim_rotations(SimTK::Vec3(0));
     constructProperty_orientation_file_for_calibration("");
     constructProperty_output_model_file("");
+    constructProperty_calibration_window_size(1);
 }
 
 //=============================================================================
@@ -100,8 +101,32 @@ bool IMUPlacer::run(bool visualizeResults) {
                     sensor_to_opensim_rotations[0], SimTK::XAxis,
                     sensor_to_opensim_rotations[1], SimTK::YAxis,
                     sensor_to_opensim_rotations[2], SimTK::ZAxis);
-    // Rotate data so Y-Axis is up
-    OpenSenseUtilities::rotateOrientationTable(quatTable, sensorToOpenSim);
+    // Rotate data so Y-Axis is up. The orientations are rotated and converted
+    // in a compact layout, which is faster for long trials; quatTable is no
+    // longer needed, so its data is released.
+    CompactOrientationsTable orientations(std::move(quatTable));
+    orientations.rotate(sensorToOpenSim);
+
+    // The orientation of each IMU used for calibration (and for the heading
+    // correction) is its average over the first calibration_window_size
+    // frames.
+    OPENSIM_THROW_IF_FRMOBJ(get_calibration_window_size() < 1, Exception,
+            "Expected calibration_window_size to be at least 1, but got " +
+                    std::to_string(get_calibration_window_size()) + ".");
+    int windowSize = get_calibration_window_size();
+    if (windowSize > orientations.getNumRows()) {
+        log_warn("IMUPlacer: calibration_window_size ({}) exceeds the number "
+                 "of frames in '{}'; all {} frames are averaged.",
+                windowSize, get_orientation_file_for_calibration(),
+                orientations.getNumRows());
+        windowSize = orientations.getNumRows();
+    }
+    CompactOrientationsTable calibrationOrientations =
+            orientations.computeAverageOrientations(0, windowSize);
+    if (windowSize > 1) {
+        log_info("IMUPlacer: calibrating with the average orientations over "
+                 "the first {} frames.", windowSize);
+    }
     // Heading correction requires initSystem is already called. Do it now.
     SimTK::State& s0 = _model->initSystem();
     _model->realizePosition(s0);
@@ -134,28 +159,31 @@ bool IMUPlacer::run(bool visualizeResults) {
         // Compute rotation matrix so that (e.g. "pelvis_imu"+ SimTK::ZAxis)
         // lines up with model forward (+X)
         SimTK::Vec3 headingRotationVec3 =
-                OpenSenseUtilities::computeHeadingCorrection(*_model, s0, quatTable,
-                        get_base_imu_label(), directionOnIMU);
+                OpenSenseUtilities::computeHeadingCorrection(*_model, s0,
+                        calibrationOrientations, get_base_imu_label(),
+                        directionOnIMU);
         SimTK::Rotation headingRotation(
                 SimTK::BodyOrSpaceType::SpaceRotationSequence,
                 headingRotationVec3[0], SimTK::XAxis, headingRotationVec3[1],
                 SimTK::YAxis, headingRotationVec3[2], SimTK::ZAxis);
 
-        OpenSenseUtilities::rotateOrientationTable(quatTable, headingRotation);
+        orientations.rotate(headingRotation);
+        calibrationOrientations.rotate(headingRotation);
     } else
         log_info("No heading correction is applied.");
 
     // This is now plain conversion, no Rotation or magic underneath
-    TimeSeriesTable_<SimTK::Rotation>
-            orientationsData =
-    OpenSenseUtilities::convertQuaternionsToRotations(quatTable);
+    TimeSeriesTable_<SimTK::Rotation> orientationsData =
+            orientations.convertToRotationsTable();
 
     auto imuLabels = orientationsData.getColumnLabels();
     auto& times = orientationsData.getIndependentColumn();
 
-    // The rotations of the IMUs at the start time in order
+    // The calibration rotations of the IMUs in order
     // the labels in the TimerSeriesTable of orientations
-    auto rotations = orientationsData.updRowAtIndex(0);
+    const TimeSeriesTable_<SimTK::Rotation> calibrationData =
+            calibrationOrientations.convertToRotationsTable();
+    auto rotations = calibrationData.getRowAtIndex(0);
 
     s0.updTime() = times[0];
 
@@ -43,6 +43,11 @@ class Model;
  * align all the IMU data so that base imu's heading (forward) is in the X direction 
  * of OpenSim's ground frame. 
  *
+ * By default, the first frame of the orientation_file_for_calibration is used.
+ * For long standing trials, the orientations can instead be averaged over the
+ * first calibration_window_size frames, which makes the calibration less
+ * sensitive to sensor noise and small movements.
+ *
  * @author Ayman Habib, Ajay Seth
  */
 class OSIMSIMULATION_API IMUPlacer : public Object {
@@ -77,6 +82,13 @@ public:
     OpenSim_DECLARE_PROPERTY(output_model_file, std::string,
             "Name of OpenSim model file (.osim) to write when done placing IMUs.");
 
+    OpenSim_DECLARE_PROPERTY(calibration_window_size, int,
+            "Number of frames, starting with the first frame of the "
+            "orientation_file_for_calibration, over which the orientation of "
+            "each IMU is averaged for calibration. Frames far from the average "
+            "(e.g., if the subject moved) are excluded. Default 1 (only the "
+            "first frame is used).");
+
 public:
     virtual ~IMUPlacer();
     IMUPlacer();
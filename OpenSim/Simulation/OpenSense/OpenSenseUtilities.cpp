@@ -25,6 +25,7 @@
 #include <OpenSim/Simulation/MarkersReference.h>
 #include <OpenSim/Simulation/InverseKinematicsSolver.h>
 #include "OpenSenseUtilities.h"
+#include "CompactOrientationsTable.h"
 #include "IMUPlacer.h"
 
 using namespace OpenSim;
@@ -71,17 +72,18 @@ void OpenSim::OpenSenseUtilities::rotateOrientationTable(
                 quaternionsTable,
         const SimTK::Rotation_<double>& rotationMatrix)
 {
-    SimTK::Rotation R_XG = rotationMatrix;
-
-    int nc = int(quaternionsTable.getNumColumns());
-    size_t nt = quaternionsTable.getNumRows();
-
-    for (size_t i = 0; i < nt; ++i) {
-        auto quatRow = quaternionsTable.updRowAtIndex(i);
-        for (int j = 0; j < nc; ++j) {
-            // This can be done completely in Quaternions but this is easier to debug for now
-            Quaternion quatO = (R_XG * Rotation(quatRow[j])).convertRotationToQuaternion();
-            quatRow[j] = quatO;
+    // Compose the quaternions directly rather than converting each one to a
+    // Rotation and back.
+    const Quaternion R_XG = rotationMatrix.convertRotationToQuaternion();
+
+    auto& matrix = quaternionsTable.updMatrix();
+    for (int i = 0; i < matrix.nrow(); ++i) {
+        for (int j = 0; j < matrix.ncol(); ++j) {
+            Quaternion& quat = matrix.updElt(i, j);
+            Vec4 q = quat.asVec4();
+            CompactOrientationsTable::rotateQuaternions(
+                    R_XG, 1, &q[0], &q[1], &q[2], &q[3]);
+            quat = Quaternion(q, true);
         }
     }
     return;
@@ -270,6 +272,27 @@ SimTK::Vec3 OpenSenseUtilities::computeHeadingCorrection(
     return rotations;
 }
 
+SimTK::Vec3 OpenSenseUtilities::computeHeadingCorrection(
+        Model& model,
+        const SimTK::State& state,
+        const CompactOrientationsTable& orientations,
+        const std::string& baseImuName,
+        const SimTK::CoordinateDirection baseHeadingDirection)
+{
+    OPENSIM_THROW_IF(orientations.getNumRows() == 0, Exception,
+            "Heading correction requires at least one row of orientations.");
+    // Only the orientations at the first time are used.
+    const int nc = orientations.getNumColumns();
+    SimTK::Matrix_<Quaternion> firstRow(1, nc);
+    for (int j = 0; j < nc; ++j)
+        firstRow.updElt(0, j) = orientations.getQuaternion(0, j);
+    TimeSeriesTable_<Quaternion> firstRowTable(
+            {orientations.getIndependentColumn()[0]}, firstRow,
+            orientations.getColumnLabels());
+    return computeHeadingCorrection(model, state, firstRowTable, baseImuName,
+            baseHeadingDirection);
+}
+
 std::vector<OpenSim::IMU* > OpenSenseUtilities::addModelIMUs(
     Model& model, std::vector<std::string>& paths) {
 
@@ -26,6 +26,7 @@
 #include <OpenSim/Simulation/osimSimulationDLL.h>
 #include <OpenSim/Common/TimeSeriesTable.h>
 #include <OpenSim/Simulation/Model/Model.h>
+#include "CompactOrientationsTable.h"
 #include "IMU.h"
 #include "IMUPlacer.h"
 
@@ -65,6 +66,13 @@ public:
                     quatTimeSeries, 
             const std::string& baseIMU, 
             const SimTK::CoordinateDirection);
+    /** Same as above, for orientations in a CompactOrientationsTable. */
+    static SimTK::Vec3 computeHeadingCorrection(
+            OpenSim::Model& model,
+            const SimTK::State& state,
+            const CompactOrientationsTable& orientations,
+            const std::string& baseIMU,
+            const SimTK::CoordinateDirection);
     /// @}
     /**
         * Create Orientations as a TimeSeriesTable based on passed in markerFile
@@ -18,13 +18,18 @@
 
 #include "PositionMotion.h"
 
+#include <OpenSim/Common/CommonUtilities.h>
 #include <OpenSim/Common/Function.h>
+#include <OpenSim/Common/GCVSpline.h>
 #include <OpenSim/Common/GCVSplineSet.h>
+#include <OpenSim/Common/TableUtilities.h>
 #include <OpenSim/Moco/MocoUtilities.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/SimbodyEngine/Coordinate.h>
 #include <OpenSim/Simulation/StatesTrajectory.h>
 
+#include <algorithm>
+
 using namespace OpenSim;
 
 class SimTKPositionMotionImplementation
@@ -152,6 +157,106 @@ std::unique_ptr<PositionMotion> PositionMotion::createFromStatesTrajectory(
             model, statesTraj.exportToTable(model, coordSVNames));
 }
 
+std::unique_ptr<PositionMotion> PositionMotion::createFromStatesTable(
+        const Model& model, const TimeSeriesTable& statesTable,
+        bool allowExtraColumns, bool assemble, int numThreads) {
+    OPENSIM_THROW_IF(TableUtilities::isInDegrees(statesTable),
+            StatesTrajectory::DataIsInDegrees);
+    const auto& labels = statesTable.getColumnLabels();
+    TableUtilities::checkNonUniqueLabels(labels);
+
+    // Match columns to state variables.
+    // ---------------------------------
+    const auto& stateNames = model.getStateVariableNames();
+    std::vector<bool> isStateColumn(labels.size(), false);
+    for (int is = 0; is < stateNames.getSize(); ++is) {
+        const int index =
+                TableUtilities::findStateLabelIndex(labels, stateNames[is]);
+        if (index != -1) isStateColumn[index] = true;
+    }
+    if (!allowExtraColumns) {
+        std::vector<std::string> extraColumnNames;
+        for (int ic = 0; ic < (int)labels.size(); ++ic) {
+            if (!isStateColumn[ic]) extraColumnNames.push_back(labels[ic]);
+        }
+        OPENSIM_THROW_IF(!extraColumnNames.empty(),
+                StatesTrajectory::ExtraColumns, model.getName(),
+                extraColumnNames);
+    }
+
+    // Gather the coordinate values, in multibody tree order.
+    // ------------------------------------------------------
+    const auto coords = model.getCoordinatesInMultibodyTreeOrder();
+    const int numCoords = (int)coords.size();
+    const auto& time = statesTable.getIndependentColumn();
+    const int numRows = (int)time.size();
+    const auto& matrix = statesTable.getMatrix();
+    // Column-major: the values for coordinate ic start at ic * numRows.
+    std::vector<double> values((std::size_t)numCoords * numRows, SimTK::NaN);
+    for (int ic = 0; ic < numCoords; ++ic) {
+        const int index = TableUtilities::findStateLabelIndex(
+                labels, coords[ic]->getStateVariableNames()[0]);
+        if (index == -1) continue;
+        double* column = values.data() + (std::size_t)ic * numRows;
+        for (int itime = 0; itime < numRows; ++itime) {
+            column[itime] = matrix(itime, index);
+        }
+    }
+
+    // Assemble each row, if necessary.
+    // --------------------------------
+    // Model::assemble() only changes the coordinates if the model has
+    // constraints or locked or prescribed coordinates.
+    const SimTK::State& defaultState = model.getWorkingState();
+    bool needsAssembly = model.getConstraintSet().getSize() > 0;
+    for (const auto& coord : coords) {
+        if (coord->isConstrained(defaultState)) needsAssembly = true;
+    }
+    if (assemble && needsAssembly) {
+        Model localModel(model);
+        SimTK::State state = localModel.initSystem();
+        // Mirror createFromStatesTable(): state variables missing from the
+        // table are NaN.
+        state.updY().setToNaN();
+        SimTK::Vector stateValues(stateNames.getSize(), SimTK::NaN);
+        std::vector<std::pair<int, int>> stateColumns;
+        for (int is = 0; is < stateNames.getSize(); ++is) {
+            const int index = TableUtilities::findStateLabelIndex(
+                    labels, stateNames[is]);
+            if (index != -1) stateColumns.emplace_back(index, is);
+        }
+        const auto localCoords = localModel.getCoordinatesInMultibodyTreeOrder();
+        for (int itime = 0; itime < numRows; ++itime) {
+            state.setTime(time[itime]);
+            for (const auto& columnAndState : stateColumns) {
+                stateValues[columnAndState.second] =
+                        matrix(itime, columnAndState.first);
+            }
+            localModel.setStateVariableValues(state, stateValues);
+            localModel.assemble(state);
+            for (int ic = 0; ic < numCoords; ++ic) {
+                values[(std::size_t)ic * numRows + itime] =
+                        localCoords[ic]->getValue(state);
+            }
+        }
+    }
+
+    // Fit the splines in parallel.
+    // ----------------------------
+    std::vector<std::unique_ptr<GCVSpline>> splines(numCoords);
+    parallelFor(numCoords, [&](int ic) {
+        const std::string label = coords[ic]->getStateVariableNames()[0];
+        splines[ic].reset(new GCVSpline(5, numRows, time.data(),
+                values.data() + (std::size_t)ic * numRows, label));
+    }, numThreads);
+
+    auto posmot = std::unique_ptr<PositionMotion>(new PositionMotion());
+    for (int ic = 0; ic < numCoords; ++ic) {
+        posmot->setPositionForCoordinate(*coords[ic], *splines[ic]);
+    }
+    return posmot;
+}
+
 TimeSeriesTable PositionMotion::exportToTable(
         const std::vector<double>& time) const {
     TimeSeriesTable table(time);
@@ -91,6 +91,24 @@ public:
     /// constraints.
     static std::unique_ptr<PositionMotion> createFromStatesTrajectory(
             const Model& model, const StatesTrajectory& statesTraj);
+    /// Create a PositionMotion that prescribes kinematics for all coordinates
+    /// in a model directly from a states table, producing the same result as
+    /// StatesTrajectory::createFromStatesTable() (with allowMissingColumns =
+    /// true) followed by createFromStatesTrajectory(), but without creating a
+    /// State for every row. Coordinates missing from the table are NaN. If
+    /// `assemble` is true and the model has constraints, or locked or
+    /// prescribed coordinates, each row is assembled (serially, reusing a
+    /// single State); the GCVSplines for the coordinates are fit in parallel
+    /// using `numThreads` threads (all cores if numThreads is less than 1).
+    /// The model must have a System (see Model::initSystem()).
+    ///
+    /// @throws StatesTrajectory::DataIsInDegrees if the table is in degrees.
+    /// @throws StatesTrajectory::ExtraColumns if the table has columns that
+    /// are not state variables in the model and allowExtraColumns is false.
+    static std::unique_ptr<PositionMotion> createFromStatesTable(
+            const Model& model, const TimeSeriesTable& statesTable,
+            bool allowExtraColumns = false, bool assemble = true,
+            int numThreads = 0);
     TimeSeriesTable exportToTable(const std::vector<double>& time) const;
 
 private:
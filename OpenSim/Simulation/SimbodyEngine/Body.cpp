@@ -181,6 +181,19 @@ void Body::setInertia(const SimTK::Inertia& inertia)
     upd_inertia()[5] = I[1][2];
 }
 
+void Body::updateMassPropertiesInSystem()
+{
+    OPENSIM_THROW_IF_FRMOBJ(!canUpdateMassPropertiesInSystem(), Exception,
+            "Cannot update the mass properties of this Body in place: either "
+            "the System has not been built or the Body was split to break a "
+            "kinematic loop. Call Model::initSystem() instead.");
+    // Discard the inertia cached from the previous property values.
+    _inertia = SimTK::Inertia();
+    const SimTK::MassProperties massProps = getMassProperties();
+    _internalRigidBody = SimTK::Body::Rigid(massProps);
+    updMobilizedBody().setDefaultMassProperties(massProps);
+}
+
 //==============================================================================
 // SCALING
 //==============================================================================
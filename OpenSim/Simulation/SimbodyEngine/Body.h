@@ -92,6 +92,19 @@ public:
      */
     SimTK::MassProperties getMassProperties() const;
 
+    /** Push the current mass, mass_center, and inertia properties into the
+        underlying SimTK::MobilizedBody of an existing System, without
+        rebuilding the System. This invalidates the System's topology, so
+        Model::initializeState() must be invoked before the new values take
+        effect. This is not possible for a Body that was split to break a
+        kinematic loop; call Model::initSystem() instead in that case.
+        @see canUpdateMassPropertiesInSystem() */
+    void updateMassPropertiesInSystem();
+    /** Whether updateMassPropertiesInSystem() can be used for this Body. */
+    bool canUpdateMassPropertiesInSystem() const {
+        return hasSystem() && _slaves.empty();
+    }
+
     /** Scale the Body's center of mass location and its inertial properties. */
     void scale(const SimTK::Vec3& scaleFactors, bool scaleMass = false);
 
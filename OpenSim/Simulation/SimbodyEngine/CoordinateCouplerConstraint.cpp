@@ -34,20 +34,23 @@
 // Excluding this from Doxygen until it has better documentation! -Sam Hamner
     /// @cond
 class CompoundFunction : public SimTK::Function {
-// returns f1(x[0]) - x[1];
+// returns scale*f1(x[0]) - x[1];
+// f1 is evaluated with calcValueAndDerivatives() to avoid allocating a
+// SimTK::Vector for its argument whenever the constraint is evaluated.
 private:
-    std::unique_ptr<const SimTK::Function> f1;
+    std::unique_ptr<const OpenSim::Function> f1;
     const double scale;
 
 public:
     
-    CompoundFunction(const SimTK::Function *cf, double scale) : f1(cf), scale(scale) {
+    CompoundFunction(const OpenSim::Function& cf, double scale) : f1(cf.clone()), scale(scale) {
+        // Create any internal SimTK::Function now rather than during the
+        // first (possibly concurrent) evaluation.
+        f1->getArgumentSize();
     }
 
     double calcValue(const SimTK::Vector& x) const override {
-        SimTK::Vector xf(1);
-        xf[0] = x[0];
-        return scale*f1->calcValue(xf)-x[1];
+        return scale*f1->calcValueAndDerivatives(x[0], 0)[0]-x[1];
     }
 
     double calcDerivative(const std::vector<int>& derivComponents, const SimTK::Vector& x) const {
@@ -56,24 +59,27 @@ public:
 
     double calcDerivative(const SimTK::Array_<int>& derivComponents, const SimTK::Vector& x) const override {
         if (derivComponents.size() == 1){
-            if (derivComponents[0]==0){
-                SimTK::Vector x1(1);
-                x1[0] = x[0];
-                return scale*f1->calcDerivative(derivComponents, x1);
-            }
+            if (derivComponents[0]==0)
+                return scale*calcDerivativeOfF1(1, x[0]);
             else if (derivComponents[0]==1)
                 return -1;
         }
         else if(derivComponents.size() == 2){
-            if (derivComponents[0]==0 && derivComponents[1] == 0){
-                SimTK::Vector x1(1);
-                x1[0] = x[0];
-                return scale*f1->calcDerivative(derivComponents, x1);
-            }
+            if (derivComponents[0]==0 && derivComponents[1] == 0)
+                return scale*calcDerivativeOfF1(2, x[0]);
         }
         return 0;
     }
 
+    // The default calcValueAndDerivatives() would also compute the lower
+    // derivatives, so use it only for functions that override it.
+    double calcDerivativeOfF1(int order, double x) const {
+        if (f1->hasFastValueAndDerivatives())
+            return f1->calcValueAndDerivatives(x, order)[order];
+        return f1->calcDerivative(std::vector<int>(order, 0),
+                SimTK::Vector(1, x));
+    }
+
     int getArgumentSize() const override {
         return 2;
     }
@@ -81,8 +87,9 @@ public:
         return 2;
     }
 
-    void setFunction(const SimTK::Function *cf) {
-        f1.reset(cf);
+    void setFunction(const OpenSim::Function& cf) {
+        f1.reset(cf.clone());
+        f1->getArgumentSize();
     }
 };
 
@@ -224,7 +231,7 @@ void CoordinateCouplerConstraint::extendAddToSystem(SimTK::MultibodySystem& syst
 
     // Create and set the underlying coupler constraint function;
     const Function& f = get_coupled_coordinates_function();
-    SimTK::Function *simtkCouplerFunction = new CompoundFunction(f.createSimTKFunction(), get_scale_factor());
+    SimTK::Function *simtkCouplerFunction = new CompoundFunction(f, get_scale_factor());
 
 
     // Now create a Simbody Constraint::CoordinateCoupler
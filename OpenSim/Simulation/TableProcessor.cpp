@@ -0,0 +1,180 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: TableProcessor.cpp                                                *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2020 Stanford University and the Authors                     *
+ *                                                                            *
+ * Author(s): Christopher Dembia, Nicholas Bianco, Prasanna Sritharan         *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "TableProcessor.h"
+
+#include <OpenSim/Common/CommonUtilities.h>
+#include <OpenSim/Common/STOFileAdapter.h>
+
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+
+using namespace OpenSim;
+
+namespace {
+struct TableMemo {
+    std::mutex mutex;
+    bool enabled = false;
+    std::string directory;
+    std::unordered_map<std::uint64_t, TimeSeriesTable> tables;
+};
+TableMemo& getTableMemo() {
+    static TableMemo memo;
+    return memo;
+}
+std::string getMemoizedTablePath(
+        const std::string& directory, std::uint64_t key) {
+    return directory + "/" + fmt::format("{:016x}", key) + ".sto";
+}
+} // anonymous namespace
+
+void TableProcessor::setMemoizationEnabled(bool enabled) {
+    auto& memo = getTableMemo();
+    std::lock_guard<std::mutex> lock(memo.mutex);
+    memo.enabled = enabled;
+}
+
+bool TableProcessor::getMemoizationEnabled() {
+    auto& memo = getTableMemo();
+    std::lock_guard<std::mutex> lock(memo.mutex);
+    return memo.enabled;
+}
+
+void TableProcessor::setMemoizationDirectory(const std::string& directory) {
+    auto& memo = getTableMemo();
+    std::lock_guard<std::mutex> lock(memo.mutex);
+    memo.directory = directory;
+}
+
+std::string TableProcessor::getMemoizationDirectory() {
+    auto& memo = getTableMemo();
+    std::lock_guard<std::mutex> lock(memo.mutex);
+    return memo.directory;
+}
+
+void TableProcessor::clearMemoizedTables() {
+    auto& memo = getTableMemo();
+    std::lock_guard<std::mutex> lock(memo.mutex);
+    memo.tables.clear();
+}
+
+std::string TableProcessor::getSourcePath(
+        const std::string& relativeToDirectory) const {
+    OPENSIM_THROW_IF_FRMOBJ(get_filepath().empty() && !m_tableProvided,
+            Exception, "No source table.");
+    OPENSIM_THROW_IF_FRMOBJ(!get_filepath().empty() && m_tableProvided,
+            Exception,
+            "Expected either an in-memory table or a filepath, but "
+            "both were provided.");
+    std::string path;
+    if (!m_tableProvided) {
+        path = get_filepath();
+        if (!relativeToDirectory.empty()) {
+            using SimTK::Pathname;
+            path = Pathname::getAbsolutePathnameUsingSpecifiedWorkingDirectory(
+                    relativeToDirectory, path);
+        }
+    }
+    return path;
+}
+
+TimeSeriesTable TableProcessor::process(
+        std::string relativeToDirectory, const Model* model) const {
+    const std::string path = getSourcePath(relativeToDirectory);
+
+    auto& memo = getTableMemo();
+    std::string directory;
+    {
+        std::lock_guard<std::mutex> lock(memo.mutex);
+        if (!memo.enabled) {
+            return processWithoutMemoization(path, model);
+        }
+        directory = memo.directory;
+    }
+
+    const std::uint64_t key = computeMemoizationKey(path, model);
+    {
+        std::lock_guard<std::mutex> lock(memo.mutex);
+        const auto it = memo.tables.find(key);
+        if (it != memo.tables.end()) return it->second;
+    }
+
+    TimeSeriesTable table;
+    const std::string memoPath =
+            directory.empty() ? "" : getMemoizedTablePath(directory, key);
+    if (!memoPath.empty() && std::ifstream(memoPath).good()) {
+        log_debug("TableProcessor: loading memoized table '{}'.", memoPath);
+        table = TimeSeriesTable(memoPath);
+    } else {
+        table = processWithoutMemoization(path, model);
+        if (!memoPath.empty()) {
+            STOFileAdapter::write(table, memoPath);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(memo.mutex);
+    memo.tables.emplace(key, table);
+    return table;
+}
+
+TimeSeriesTable TableProcessor::processWithoutMemoization(
+        const std::string& sourcePath, const Model* model) const {
+    TimeSeriesTable table;
+    if (m_tableProvided) {
+        table = m_table;
+    } else {
+        table = TimeSeriesTable(sourcePath);
+    }
+
+    for (int i = 0; i < getProperty_operators().size(); ++i) {
+        get_operators(i).operate(table, model);
+    }
+    return table;
+}
+
+std::uint64_t TableProcessor::computeMemoizationKey(
+        const std::string& sourcePath, const Model* model) const {
+    std::uint64_t key;
+    if (m_tableProvided) {
+        // The operators only depend on the table's data, column labels, and
+        // whether it is in degrees.
+        key = computeContentHash(std::string(
+                TableUtilities::isInDegrees(m_table) ? "degrees" : ""));
+        for (const auto& label : m_table.getColumnLabels()) {
+            key = computeContentHash(label, key);
+        }
+        const auto& times = m_table.getIndependentColumn();
+        key = computeContentHash(
+                times.data(), times.size() * sizeof(double), key);
+        const auto& matrix = m_table.getMatrix();
+        for (int icol = 0; icol < matrix.ncol(); ++icol) {
+            for (int irow = 0; irow < matrix.nrow(); ++irow) {
+                const double value = matrix(irow, icol);
+                key = computeContentHash(&value, sizeof(double), key);
+            }
+        }
+    } else {
+        key = computeFileContentHash(sourcePath);
+    }
+    for (int i = 0; i < getProperty_operators().size(); ++i) {
+        key = computeContentHash(get_operators(i).dump(), key);
+    }
+    if (model) key = computeContentHash(model->dump(), key);
+    return key;
+}
@@ -20,6 +20,7 @@
 
 #include "SimulationUtilities.h"
 #include <algorithm>
+#include <cstdint>
 
 #include <OpenSim/Common/TableUtilities.h>
 #include <OpenSim/Common/TimeSeriesTable.h>
@@ -44,7 +45,19 @@ to a table or an in-memory TimeSeriesTable. In C++, one can easily chain
 together the operators in a processor using the C++ pipe operator:
 @code
 TableProcessor proc = TableProcessor("file.sto") | TabOpLowPassFilter(6);
-@endcode */
+@endcode
+
+@par Memoization
+The same processor is often processed many times with the same inputs (e.g.,
+by scripts that solve many MocoTrack or MocoInverse problems). If memoization
+is enabled with setMemoizationEnabled(), process() stores each processed table
+under a key computed from the contents of the source table (the bytes of the
+file, or the data of the in-memory table), the serialized operators, and the
+serialized model (if one is provided), and returns a copy of the stored table
+when it is called again with the same key. Editing the source file or any
+operator therefore produces a new key. If a directory is set with
+setMemoizationDirectory(), processed tables are also written there as .sto
+files so they can be reused by other processes. */
 class OSIMSIMULATION_API TableProcessor : public Object {
     OpenSim_DECLARE_CONCRETE_OBJECT(TableProcessor, Object);
 
@@ -79,32 +92,7 @@ public:
     contains such an operator, then the operator will throw an exception
     if you do not provide a model when invoking this function. */
     TimeSeriesTable process(std::string relativeToDirectory,
-            const Model* model = nullptr) const {
-        OPENSIM_THROW_IF_FRMOBJ(get_filepath().empty() && !m_tableProvided,
-                Exception, "No source table.");
-        OPENSIM_THROW_IF_FRMOBJ(!get_filepath().empty() && m_tableProvided,
-                Exception,
-                "Expected either an in-memory table or a filepath, but "
-                "both were provided.");
-        TimeSeriesTable table;
-        if (m_tableProvided) {
-            table = m_table;
-        } else {
-            std::string path = get_filepath();
-            if (!relativeToDirectory.empty()) {
-                using SimTK::Pathname;
-                path = Pathname::
-                        getAbsolutePathnameUsingSpecifiedWorkingDirectory(
-                                relativeToDirectory, path);
-            }
-            table = TimeSeriesTable(path);
-        }
-
-        for (int i = 0; i < getProperty_operators().size(); ++i) {
-            get_operators(i).operate(table, model);
-        }
-        return table;
-    }
+            const Model* model = nullptr) const;
     /** Same as above, but paths are evaluated with respect to the current
     working directory. */
     TimeSeriesTable process(const Model* model = nullptr) const {
@@ -127,6 +115,16 @@ public:
     TimeSeriesTable processAndConvertToRadians(const Model& model) const {
         return processAndConvertToRadians({}, model);
     }
+    /** A hash of everything that determines the output of process() without
+    a model: the contents of the source table (in-memory or read from the
+    file) and the serialized operators. This is the key used for memoization,
+    and can be used by callers that cache objects derived from the processed
+    table. */
+    std::uint64_t computeContentKey(
+            const std::string& relativeToDirectory = {}) const {
+        return computeMemoizationKey(
+                getSourcePath(relativeToDirectory), nullptr);
+    }
     /** Returns true if neither a filepath nor an in-memory table have been
     provided. */
     bool empty() const {
@@ -154,7 +152,35 @@ public:
         return append(right);
     }
 
+    /// @name Memoization
+    /// These settings apply to all TableProcessors in this process.
+    /// @{
+    /** Enable or disable memoization of processed tables (disabled by
+    default). */
+    static void setMemoizationEnabled(bool enabled);
+    static bool getMemoizationEnabled();
+    /** Also store processed tables in (and load them from) this directory,
+    which must exist. Pass an empty string (the default) to memoize in memory
+    only. */
+    static void setMemoizationDirectory(const std::string& directory);
+    static std::string getMemoizationDirectory();
+    /** Remove all processed tables memoized in memory. Files in the
+    memoization directory are not removed. */
+    static void clearMemoizedTables();
+    /// @}
+
 private:
+    /// The path to the source table file, or an empty string if the source
+    /// is an in-memory table.
+    std::string getSourcePath(const std::string& relativeToDirectory) const;
+    /// Read the source table and apply the operators, without memoization.
+    TimeSeriesTable processWithoutMemoization(
+            const std::string& sourcePath, const Model* model) const;
+    /// Compute the memoization key for processing the source table at
+    /// `sourcePath` (or the in-memory table) with `model`.
+    std::uint64_t computeMemoizationKey(
+            const std::string& sourcePath, const Model* model) const;
+
     bool m_tableProvided = false;
     TimeSeriesTable m_table;
 };
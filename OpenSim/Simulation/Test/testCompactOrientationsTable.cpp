@@ -0,0 +1,261 @@
+/* -------------------------------------------------------------------------- *
+ *                 OpenSim:  testCompactOrientationsTable.cpp                 *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2022 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Common/Logger.h>
+#include <OpenSim/Common/Stopwatch.h>
+#include <OpenSim/Simulation/OpenSense/CompactOrientationsTable.h>
+#include <OpenSim/Simulation/OpenSense/OpenSenseUtilities.h>
+
+#include <cmath>
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/catch.hpp>
+
+using namespace OpenSim;
+
+namespace {
+// A table of random orientations, with a few missing (NaN) orientations.
+TimeSeriesTableQuaternion createQuaternionsTable(int numRows, int numColumns) {
+    SimTK::Random::Uniform random(-SimTK::Pi, SimTK::Pi);
+    random.setSeed(42);
+    std::vector<double> times(numRows);
+    std::vector<std::string> labels;
+    for (int j = 0; j < numColumns; ++j) {
+        labels.push_back("imu" + std::to_string(j));
+    }
+    SimTK::Matrix_<SimTK::Quaternion> matrix(numRows, numColumns);
+    for (int i = 0; i < numRows; ++i) {
+        times[i] = 0.01 * i;
+        for (int j = 0; j < numColumns; ++j) {
+            SimTK::Rotation R(SimTK::BodyOrSpaceType::BodyRotationSequence,
+                    random.getValue(), SimTK::XAxis, random.getValue(),
+                    SimTK::YAxis, random.getValue(), SimTK::ZAxis);
+            matrix.updElt(i, j) = R.convertRotationToQuaternion();
+        }
+    }
+    if (numRows > 3 && numColumns > 1) {
+        matrix.updElt(3, 1) = SimTK::Quaternion(SimTK::Vec4(SimTK::NaN), true);
+    }
+    TimeSeriesTableQuaternion table(times, matrix, labels);
+    table.updTableMetaData().setValueForKey("DataRate", std::string("100"));
+    return table;
+}
+
+// q and -q are the same orientation.
+bool isSameOrientation(const SimTK::Quaternion& a, const SimTK::Quaternion& b,
+        double tolerance) {
+    if (a.isNaN() || b.isNaN()) return a.isNaN() && b.isNaN();
+    const double sign = ~a.asVec4() * b.asVec4() < 0 ? -1.0 : 1.0;
+    return (a.asVec4() - sign * b.asVec4()).normInf() <= tolerance;
+}
+} // anonymous namespace
+
+TEST_CASE("CompactOrientationsTable matches rotating SimTK::Rotation") {
+    const auto quatTable = createQuaternionsTable(20, 4);
+    const SimTK::Rotation sensorToOpenSim(
+            SimTK::BodyOrSpaceType::SpaceRotationSequence, -SimTK::Pi / 2,
+            SimTK::XAxis, 0, SimTK::YAxis, 0, SimTK::ZAxis);
+    const SimTK::Rotation heading(SimTK::BodyOrSpaceType::SpaceRotationSequence,
+            0, SimTK::XAxis, 0.3, SimTK::YAxis, 0, SimTK::ZAxis);
+
+    CompactOrientationsTable orientations(quatTable);
+    REQUIRE(orientations.getNumRows() == 20);
+    REQUIRE(orientations.getNumColumns() == 4);
+    orientations.rotate(sensorToOpenSim);
+    orientations.rotate(heading);
+
+    const auto rotated = orientations.convertToQuaternionsTable();
+    const auto rotations = orientations.convertToRotationsTable();
+    CHECK(rotated.getColumnLabels() == quatTable.getColumnLabels());
+    CHECK(rotations.getIndependentColumn() ==
+            quatTable.getIndependentColumn());
+    CHECK(rotations.getTableMetaData<std::string>("DataRate") == "100");
+
+    for (int i = 0; i < quatTable.getNumRows(); ++i) {
+        for (int j = 0; j < quatTable.getNumColumns(); ++j) {
+            CAPTURE(i, j);
+            const SimTK::Quaternion& q = quatTable.getMatrix().getElt(i, j);
+            const SimTK::Quaternion& actual = rotated.getMatrix().getElt(i, j);
+            if (q.isNaN()) {
+                CHECK(actual.isNaN());
+                CHECK(rotations.getMatrix().getElt(i, j).isNaN());
+                continue;
+            }
+            const SimTK::Rotation expected =
+                    heading * (sensorToOpenSim * SimTK::Rotation(q));
+            CHECK(actual[0] >= 0);
+            CHECK(isSameOrientation(actual,
+                    expected.convertRotationToQuaternion(), 1e-12));
+            CHECK((rotations.getMatrix().getElt(i, j).asMat33() -
+                          expected.asMat33())
+                            .normInf() <= 1e-12);
+        }
+    }
+}
+
+TEST_CASE("rotateOrientationTable matches rotating SimTK::Rotation") {
+    const auto original = createQuaternionsTable(10, 3);
+    const SimTK::Rotation rotation(SimTK::BodyOrSpaceType::SpaceRotationSequence,
+            0.1, SimTK::XAxis, -0.7, SimTK::YAxis, 1.2, SimTK::ZAxis);
+    auto quatTable = original;
+    OpenSenseUtilities::rotateOrientationTable(quatTable, rotation);
+    for (int i = 0; i < quatTable.getNumRows(); ++i) {
+        for (int j = 0; j < quatTable.getNumColumns(); ++j) {
+            CAPTURE(i, j);
+            const SimTK::Quaternion& q = original.getMatrix().getElt(i, j);
+            const SimTK::Quaternion& actual =
+                    quatTable.getMatrix().getElt(i, j);
+            if (q.isNaN()) {
+                CHECK(actual.isNaN());
+                continue;
+            }
+            const SimTK::Rotation expected = rotation * SimTK::Rotation(q);
+            CHECK(isSameOrientation(actual,
+                    expected.convertRotationToQuaternion(), 1e-12));
+        }
+    }
+}
+
+TEST_CASE("CompactOrientationsTable averages orientations over a window") {
+    // Noisy orientations about a fixed orientation of each column, with
+    // flipped signs, a few frames of movement, and missing orientations.
+    const int numRows = 200;
+    const int numColumns = 5;
+    SimTK::Random::Gaussian noise(0, 0.002);
+    noise.setSeed(7);
+    std::vector<SimTK::Rotation> expected;
+    for (int j = 0; j < numColumns; ++j) {
+        expected.emplace_back(SimTK::BodyOrSpaceType::BodyRotationSequence,
+                0.5 * j, SimTK::XAxis, -0.3 * j, SimTK::YAxis, 2.0 + j,
+                SimTK::ZAxis);
+    }
+    std::vector<double> times(numRows);
+    SimTK::Matrix_<SimTK::Quaternion> matrix(numRows, numColumns);
+    for (int i = 0; i < numRows; ++i) {
+        times[i] = 0.01 * i;
+        for (int j = 0; j < numColumns; ++j) {
+            const double outlier = (i % 40 == 5) ? 0.5 : 0;
+            const SimTK::Rotation R = expected[j] *
+                    SimTK::Rotation(SimTK::BodyOrSpaceType::BodyRotationSequence,
+                            noise.getValue() + outlier, SimTK::XAxis,
+                            noise.getValue(), SimTK::YAxis, noise.getValue(),
+                            SimTK::ZAxis);
+            SimTK::Vec4 q = R.convertRotationToQuaternion().asVec4();
+            if (i % 3 == 0) q = -q;
+            matrix.updElt(i, j) = SimTK::Quaternion(q, true);
+        }
+    }
+    // Column 3 starts with a missing orientation, and column 4 is missing.
+    matrix.updElt(0, 3) = SimTK::Quaternion(SimTK::Vec4(SimTK::NaN), true);
+    for (int i = 0; i < numRows; ++i) {
+        matrix.updElt(i, 4) = SimTK::Quaternion(SimTK::Vec4(SimTK::NaN), true);
+    }
+    const CompactOrientationsTable orientations(TimeSeriesTableQuaternion(
+            times, matrix, {"a_imu", "b_imu", "c_imu", "d_imu", "e_imu"}));
+
+    const auto average = orientations.computeAverageOrientations(0, numRows);
+    REQUIRE(average.getNumRows() == 1);
+    CHECK(average.getIndependentColumn()[0] == times[0]);
+    CHECK(average.getColumnLabels() == orientations.getColumnLabels());
+    for (int j = 0; j < numColumns - 1; ++j) {
+        CAPTURE(j);
+        const SimTK::Quaternion q = average.getQuaternion(0, j);
+        CHECK(q[0] >= 0);
+        CHECK(std::abs(q.norm() - 1) < 1e-12);
+        // The movement frames would otherwise shift the average by ~0.01 rad.
+        const SimTK::Rotation error = ~expected[j] * SimTK::Rotation(q);
+        CHECK(error.convertRotationToAngleAxis()[0] < 1e-3);
+    }
+    CHECK(average.getQuaternion(0, 4).isNaN());
+
+    // A single frame is copied unchanged.
+    const auto single = orientations.computeAverageOrientations(10, 1);
+    CHECK(single.getIndependentColumn()[0] == times[10]);
+    for (int j = 0; j < numColumns - 1; ++j) {
+        CHECK(single.getQuaternion(0, j).asVec4() ==
+                orientations.getQuaternion(10, j).asVec4());
+    }
+
+    CHECK_THROWS_AS(orientations.computeAverageOrientations(0, 0), Exception);
+    CHECK_THROWS_AS(
+            orientations.computeAverageOrientations(1, numRows), Exception);
+}
+
+TEST_CASE("CompactOrientationsTable releases a moved table") {
+    auto quatTable = createQuaternionsTable(10, 3);
+    const CompactOrientationsTable copied(quatTable);
+    const CompactOrientationsTable moved(std::move(quatTable));
+    CHECK(quatTable.getNumRows() == 0);
+    CHECK(quatTable.getNumColumns() == 0);
+    REQUIRE(moved.getNumRows() == 10);
+    CHECK(moved.getColumnLabels() == copied.getColumnLabels());
+    CHECK(moved.getIndependentColumn() == copied.getIndependentColumn());
+    for (int i = 0; i < moved.getNumRows(); ++i) {
+        for (int j = 0; j < moved.getNumColumns(); ++j) {
+            CAPTURE(i, j);
+            CHECK(isSameOrientation(moved.getQuaternion(i, j),
+                    copied.getQuaternion(i, j), 0));
+        }
+    }
+}
+
+TEST_CASE("CompactOrientationsTable benchmark", "[.benchmark]") {
+    // A 10-minute trial of 17 IMUs at 100 Hz, vs. rotating SimTK::Rotations.
+    const int numRows = 100 * 60 * 10;
+    const int numColumns = 17;
+    const auto quatTable = createQuaternionsTable(numRows, numColumns);
+    const SimTK::Rotation sensorToOpenSim(
+            SimTK::BodyOrSpaceType::SpaceRotationSequence, -SimTK::Pi / 2,
+            SimTK::XAxis, 0, SimTK::YAxis, 0, SimTK::ZAxis);
+
+    Stopwatch watch;
+    CompactOrientationsTable orientations(quatTable);
+    orientations.rotate(sensorToOpenSim);
+    const auto compactRotations = orientations.convertToRotationsTable();
+    const double compactTime = watch.getElapsedTime();
+
+    watch.reset();
+    SimTK::Matrix_<SimTK::Quaternion> matrix = quatTable.getMatrix();
+    for (int i = 0; i < numRows; ++i) {
+        for (int j = 0; j < numColumns; ++j) {
+            matrix.updElt(i, j) = (sensorToOpenSim *
+                    SimTK::Rotation(matrix.getElt(i, j)))
+                            .convertRotationToQuaternion();
+        }
+    }
+    TimeSeriesTableQuaternion rotated(quatTable.getIndependentColumn(),
+            matrix, quatTable.getColumnLabels());
+    const auto rotations =
+            OpenSenseUtilities::convertQuaternionsToRotations(rotated);
+    const double rotationTime = watch.getElapsedTime();
+
+    CHECK(compactRotations.getNumRows() == rotations.getNumRows());
+    const double numElements = (double)numRows * numColumns;
+    log_info("Rotating and converting {} orientations took {} s with "
+             "CompactOrientationsTable ({} M/s) and {} s with SimTK::Rotation "
+             "({} M/s). Orientations use {} MB, vs. {} MB as rotations.",
+            numRows * numColumns, compactTime,
+            1e-6 * numElements / compactTime, rotationTime,
+            1e-6 * numElements / rotationTime,
+            1e-6 * orientations.getNumBytesOfOrientations(),
+            1e-6 * numElements * sizeof(SimTK::Rotation));
+}
@@ -0,0 +1,97 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: testCustomJointKinematics.cpp                                     *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2022 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/auxiliaryTestSimulationFunctions.h>
+#include <OpenSim/Auxiliary/catch.hpp>
+#include <OpenSim/Common/LoadOpenSimLibrary.h>
+#include <OpenSim/Common/Stopwatch.h>
+#include <OpenSim/Simulation/osimSimulation.h>
+
+#include <memory>
+
+using namespace OpenSim;
+
+TEST_CASE("CustomJoint mobilizer functions match the OpenSim functions") {
+    // The SimTK::Functions given to the FunctionBased mobilizers are
+    // specialized for some OpenSim Functions (e.g., SimmSpline); they must
+    // evaluate exactly the same as the OpenSim Functions in the model.
+    LoadOpenSimLibrary("osimActuators");
+    const auto modelFile =
+            GENERATE(as<std::string>{}, "gait2354_simbody.osim",
+                    "knee_patella_ligament.osim");
+    CAPTURE(modelFile);
+    Model model(modelFile);
+    model.initSystem();
+
+    SimTK::Random::Uniform random(-2.5, 2.5);
+    random.setSeed(0);
+    const std::vector<int> d1{0};
+    const std::vector<int> d2{0, 0};
+    const SimTK::Array_<int> d1Array(d1);
+    const SimTK::Array_<int> d2Array(d2);
+    for (const auto& joint : model.getComponentList<CustomJoint>()) {
+        const SpatialTransform& transform = joint.getSpatialTransform();
+        for (int iaxis = 0; iaxis < SpatialTransform::NumTransformAxes;
+                ++iaxis) {
+            const TransformAxis& axis = transform.getTransformAxis(iaxis);
+            if (!axis.hasFunction()) continue;
+            const Function& function = axis.getFunction();
+            if (function.getArgumentSize() != 1) continue;
+            std::unique_ptr<SimTK::Function> simtkFunction(
+                    function.createSimTKFunction());
+            for (int i = 0; i < 20; ++i) {
+                const SimTK::Vector x(1, random.getValue());
+                CHECK(simtkFunction->calcValue(x) == function.calcValue(x));
+                if (function.getMaxDerivativeOrder() < 1) continue;
+                CHECK(simtkFunction->calcDerivative(d1Array, x) ==
+                        function.calcDerivative(d1, x));
+                if (function.getMaxDerivativeOrder() < 2) continue;
+                CHECK(simtkFunction->calcDerivative(d2Array, x) ==
+                        function.calcDerivative(d2, x));
+            }
+        }
+    }
+}
+
+TEST_CASE("CustomJoint kinematics benchmark", "[.benchmark]") {
+    // Inverse dynamics uses the second derivatives of the transform functions.
+    LoadOpenSimLibrary("osimActuators");
+    const auto modelFile =
+            GENERATE(as<std::string>{}, "gait2354_simbody.osim",
+                    "knee_patella_ligament.osim");
+    Model model(modelFile);
+    SimTK::State state = model.initSystem();
+    const auto& matter = model.getMatterSubsystem();
+
+    SimTK::Random::Uniform random(0, 1);
+    random.setSeed(0);
+    const int numEvaluations = 2000;
+    const SimTK::Vector udot(state.getNU(), 0.5);
+    SimTK::Vector residual;
+    Stopwatch watch;
+    for (int i = 0; i < numEvaluations; ++i) {
+        randomizeCoordinates(model, state, random);
+        model.realizeVelocity(state);
+        matter.calcResidualForceIgnoringConstraints(state, SimTK::Vector(),
+                SimTK::Vector_<SimTK::SpatialVec>(), udot, residual);
+    }
+    const double elapsed = watch.getElapsedTime();
+    CHECK(residual.size() == state.getNU());
+    log_info("{}: {} kinematics evaluations took {} ({} us per evaluation).",
+            modelFile, numEvaluations, watch.getElapsedTimeFormatted(),
+            1e6 * elapsed / numEvaluations);
+}
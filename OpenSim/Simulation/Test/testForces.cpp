@@ -30,7 +30,7 @@
 //      4. HuntCrossleyForce
 //      5. SmoothSphereHalfSpaceForce
 //      6. CoordinateLimitForce
-//      7. RotationalCoordinateLimitForce
+//      7. RotationalCoordinateLimitForce (and its force curve)
 //      8. ExternalForce
 //      9. PathSpring
 //     10. ExpressionBasedPointToPointForce
@@ -68,6 +68,7 @@ void testHuntCrossleyForce();
 void testSmoothSphereHalfSpaceForce();
 void testCoordinateLimitForce();
 void testCoordinateLimitForceRotational();
+void testCoordinateLimitForceCurve();
 void testExpressionBasedPointToPointForce();
 void testExpressionBasedCoordinateForce();
 void testSerializeDeserialize();
@@ -149,6 +150,12 @@ int main() {
         failures.push_back("testCoordinateLimitForceRotational");
     }
 
+    try { testCoordinateLimitForceCurve(); }
+    catch (const std::exception& e){
+        cout << e.what() <<endl;
+        failures.push_back("testCoordinateLimitForceCurve");
+    }
+
     try { testExpressionBasedPointToPointForce(); }
     catch (const std::exception& e){
         cout << e.what() <<endl;
@@ -1568,6 +1575,68 @@ void testCoordinateLimitForce() {
     reporter->getForceStorage().print("limit_forces.mot");
 }
 
+// Compare the force of a CoordinateLimitForce over its range of motion to the
+// force computed with SimTK::Function::Step transitions, as the force was
+// computed before the transitions were inlined.
+void testCoordinateLimitForceCurve() {
+    using namespace SimTK;
+
+    Model model;
+    OpenSim::Body* block = new OpenSim::Body(
+            "block", 1, Vec3(0), Inertia::brick(0.1, 0.1, 0.1));
+    PinJoint* pin = new PinJoint("pin", model.getGround(), *block);
+    auto& coord = pin->updCoordinate();
+    coord.setName("theta");
+    model.addBody(block);
+    model.addJoint(pin);
+
+    // Angular limits and stiffnesses are in degrees.
+    const double upper = 90, lower = -30;
+    const double K_upper = 10.0, K_lower = 20.0;
+    const double damping = 0.1;
+    const double trans = 5.0;
+    auto* limitForce = new CoordinateLimitForce(
+            "theta", upper, K_upper, lower, K_lower, damping, trans);
+    model.addForce(limitForce);
+    SimTK::State& state = model.initSystem();
+
+    // The previous implementation, in SI units.
+    const double w = SimTK_RADIAN_TO_DEGREE;
+    const double qup = upper / w, qlow = lower / w;
+    const double Kup = K_upper * w, Klow = K_lower * w, damp = damping * w;
+    const Function::Step upStep(0.0, Kup, qup, qup + trans / w);
+    const Function::Step loStep(Klow, 0.0, qlow - trans / w, qlow);
+
+    const double qdot = 0.7;
+    coord.setSpeedValue(state, qdot);
+    for (double deg = lower - 2 * trans; deg <= upper + 2 * trans;
+            deg += 0.25) {
+        const double q = deg / w;
+        coord.setValue(state, q);
+        model.realizeVelocity(state);
+        const double force = limitForce->calcLimitForce(state);
+
+        const Vector qv(1, q);
+        const double K_up = upStep.calcValue(qv);
+        const double K_low = loStep.calcValue(qv);
+        const double expected = -K_up * (q - qup) + K_low * (qlow - q) -
+                                damp * (K_up / Kup + K_low / Klow) * qdot;
+        ASSERT_EQUAL(expected, force, 1e-10 * std::max(1.0, std::abs(expected)),
+                __FILE__, __LINE__,
+                "CoordinateLimitForce differs from the Function::Step "
+                "transitions at " + std::to_string(deg) + " degrees.");
+
+        // Away from the transitions, the force is linear or zero.
+        if (deg > upper + trans) {
+            ASSERT_EQUAL(-Kup * (q - qup) - damp * qdot, force, 1e-10);
+        } else if (deg < lower - trans) {
+            ASSERT_EQUAL(Klow * (qlow - q) - damp * qdot, force, 1e-10);
+        } else if (deg > lower && deg < upper) {
+            ASSERT_EQUAL(0.0, force, 1e-12);
+        }
+    }
+}
+
 void testCoordinateLimitForceRotational() {
     using namespace SimTK;
 
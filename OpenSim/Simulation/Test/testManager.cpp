@@ -37,6 +37,10 @@ Manager Tests:
 4. testConstructors: Ensure different constructors work as intended.
 5. testIntegratorInterface: Ensure setting integrator options works as intended.
 6. testExceptions: Test that misuse actually triggers exceptions.
+7. testIntegratorAutoSelect: Ensure automatic integrator selection picks one
+   of the candidate integrators and that the simulation is still accurate.
+8. testRealTimeMode: Step gait2354 with a controller in fixed real-time steps
+   and report the per-step timing statistics.
 
 //=============================================================================*/
 #include <OpenSim/Simulation/Model/Model.h>
@@ -56,6 +60,8 @@ void testExcitationUpdatesWithManager();
 void testConstructors();
 void testIntegratorInterface();
 void testExceptions();
+void testIntegratorAutoSelect();
+void testRealTimeMode();
 
 int main()
 {
@@ -97,6 +103,18 @@ int main()
         failures.push_back("testExceptions");
     }
 
+    try { testIntegratorAutoSelect(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testIntegratorAutoSelect");
+    }
+
+    try { testRealTimeMode(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testRealTimeMode");
+    }
+
     if (!failures.empty()) {
         cout << "Done, with failure(s): " << failures << endl;
         return 1;
@@ -478,3 +496,90 @@ void testExceptions()
     manager.setIntegratorAccuracy(1e-4);
     manager.setIntegratorMinimumStepSize(0.01);
 }
+
+void testIntegratorAutoSelect()
+{
+    cout << "Running testIntegratorAutoSelect" << endl;
+
+    using SimTK::Vec3;
+    const double gravity = 9.81;
+
+    // Create a simple model consisting of an unconstrained ball.
+    Model model;
+    model.setGravity(Vec3(0, -gravity, 0));
+    auto ball = new Body("ball", 1., Vec3(0), SimTK::Inertia::sphere(1.));
+    model.addBody(ball);
+    auto freeJoint = new FreeJoint("freeJoint", model.getGround(), *ball);
+    model.addJoint(freeJoint);
+    SimTK::State state = model.initSystem();
+
+    Manager manager(model);
+    manager.setIntegratorAccuracy(1e-6);
+    manager.setIntegratorAutoSelect(0.1,
+            {Manager::IntegratorMethod::RungeKutta2,
+             Manager::IntegratorMethod::RungeKuttaMerson});
+    manager.initialize(state);
+
+    const auto method = manager.getIntegratorMethod();
+    SimTK_TEST(method == Manager::IntegratorMethod::RungeKutta2 ||
+               method == Manager::IntegratorMethod::RungeKuttaMerson);
+
+    // The simulation starts at the initial state, not at the end of the
+    // trial interval.
+    const double duration = 0.5;
+    state = manager.integrate(duration);
+    const auto& coord = freeJoint->getCoordinate(FreeJoint::Coord::TranslationY);
+    SimTK_TEST_EQ_TOL(coord.getValue(state),
+            -0.5 * gravity * duration * duration, 1e-5);
+
+    // Can't enable automatic selection after initializing.
+    ASSERT_THROW(Exception, manager.setIntegratorAutoSelect(0.1));
+}
+
+void testRealTimeMode()
+{
+    cout << "Running testRealTimeMode" << endl;
+    LoadOpenSimLibrary("osimActuators");
+    Model model("gait2354_simbody.osim");
+
+    // Controller in the loop: constant excitations for all actuators.
+    auto* controller = new PrescribedController();
+    controller->setActuators(model.updActuators());
+    for (int i = 0; i < model.getActuators().getSize(); ++i) {
+        controller->prescribeControlForActuator(
+                model.getActuators().get(i).getName(), new Constant(0.1));
+    }
+    model.addController(controller);
+    SimTK::State state = model.initSystem();
+    model.equilibrateMuscles(state);
+
+    const double stepSize = 0.001;
+    Manager manager(model);
+    manager.setIntegratorMethod(Manager::IntegratorMethod::RungeKutta2);
+    manager.setRealTimeMode(stepSize);
+    manager.initialize(state);
+
+    // A 1 kHz loop for 0.2 s.
+    const int numSteps = 200;
+    for (int i = 1; i <= numSteps; ++i) {
+        const SimTK::State& s = manager.stepRealTime();
+        SimTK_TEST_EQ(s.getTime(), i * stepSize);
+    }
+    manager.logRealTimeStatistics();
+
+    const auto& stats = manager.getRealTimeStatistics();
+    SimTK_TEST(stats.numSteps == numSteps);
+    SimTK_TEST(stats.maxStepTime >= stats.getMeanStepTime());
+    cout << "Mean step time: " << stats.getMeanStepTime() << " s, max step "
+         << "time: " << stats.maxStepTime << " s, overruns: "
+         << stats.numOverruns << endl;
+
+    // Nothing is written to Storage in real-time mode.
+    SimTK_TEST(manager.getStateStorage().getSize() == 0);
+
+    // Real-time mode must be enabled before initializing.
+    ASSERT_THROW(Exception, manager.setRealTimeMode(stepSize));
+    Manager manager2(model);
+    manager2.initialize(state);
+    ASSERT_THROW(Exception, manager2.stepRealTime());
+}
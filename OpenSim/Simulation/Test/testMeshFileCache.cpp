@@ -0,0 +1,134 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: testMeshFileCache.cpp                                             *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2022 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/catch.hpp>
+#include <OpenSim/Common/Stopwatch.h>
+#include <OpenSim/Simulation/osimSimulation.h>
+
+#include <memory>
+
+using namespace OpenSim;
+
+namespace {
+// A chain of bodies, each with a Mesh from one of the given files.
+std::unique_ptr<Model> createModelWithMeshes(int numBodies,
+        const std::vector<std::string>& meshFiles) {
+    auto model = std::unique_ptr<Model>(new Model());
+    model->setName("meshes");
+    const PhysicalFrame* parent = &model->getGround();
+    for (int i = 0; i < numBodies; ++i) {
+        const std::string name = "b" + std::to_string(i);
+        auto* body = new Body(name, 1, SimTK::Vec3(0), SimTK::Inertia(1));
+        body->attachGeometry(new Mesh(meshFiles[i % meshFiles.size()]));
+        model->addBody(body);
+        model->addJoint(new PinJoint("j" + std::to_string(i), *parent,
+                SimTK::Vec3(0, -0.2, 0), SimTK::Vec3(0), *body,
+                SimTK::Vec3(0), SimTK::Vec3(0)));
+        parent = body;
+    }
+    return model;
+}
+
+// Generate the decorations of each Mesh in the model, which reads the mesh
+// files the first time.
+int countMeshDecorations(const Model& model, const SimTK::State& state) {
+    int numDecorations = 0;
+    for (const auto& mesh : model.getComponentList<Mesh>()) {
+        SimTK::Array_<SimTK::DecorativeGeometry> geometry;
+        mesh.generateDecorations(true, model.getDisplayHints(), state,
+                geometry);
+        numDecorations += (int)geometry.size();
+    }
+    return numDecorations;
+}
+} // anonymous namespace
+
+TEST_CASE("MeshFileCache shares meshes by absolute path") {
+    REQUIRE(MeshFileCache::getNumMeshes() == 0);
+    {
+        const auto a = MeshFileCache::load("sphere_10cm_radius.obj");
+        const auto b = MeshFileCache::load(
+                SimTK::Pathname::getAbsolutePathname("sphere_10cm_radius.obj"));
+        const auto c = MeshFileCache::load("sphere_10cm_radius.stl");
+        CHECK(a == b);
+        CHECK(a != c);
+        CHECK(a->getMesh().getNumVertices() > 0);
+        CHECK(MeshFileCache::getNumMeshes() == 2);
+    }
+    // The meshes are released once they are no longer used.
+    CHECK(MeshFileCache::getNumMeshes() == 0);
+    CHECK_THROWS(MeshFileCache::load("nonexistent_mesh.obj"));
+}
+
+TEST_CASE("Meshes are loaded lazily and shared by model copies") {
+    auto model = createModelWithMeshes(4, {"sphere_10cm_radius.obj"});
+    model->print("meshes.osim");
+
+    Model loaded("meshes.osim");
+    SimTK::State state = loaded.initSystem();
+    // Nothing has been visualized yet.
+    CHECK(MeshFileCache::getNumMeshes() == 0);
+
+    CHECK(countMeshDecorations(loaded, state) == 4);
+    CHECK(MeshFileCache::getNumMeshes() == 1);
+
+    Model copy(loaded);
+    SimTK::State copyState = copy.initSystem();
+    CHECK(countMeshDecorations(copy, copyState) == 4);
+    CHECK(MeshFileCache::getNumMeshes() == 1);
+}
+
+TEST_CASE("Mesh loading benchmark", "[.benchmark]") {
+    // The right leg bone meshes of the gait models; the copies use the cache.
+    const std::vector<std::string> meshFiles{"r_pelvis.vtp", "sacrum.vtp",
+            "femur_r.vtp", "tibia_r.vtp", "r_fibula.vtp", "r_talus.vtp",
+            "r_foot.vtp"};
+    const int numBodies = 35;
+    auto model = createModelWithMeshes(numBodies, meshFiles);
+    model->print("benchmark_meshes.osim");
+
+    Stopwatch watch;
+    Model loaded("benchmark_meshes.osim");
+    SimTK::State state = loaded.initSystem();
+    const double startupTime = watch.getElapsedTime();
+    watch.reset();
+    CHECK(countMeshDecorations(loaded, state) == numBodies);
+    const double firstVisualizationTime = watch.getElapsedTime();
+
+    const int numCopies = 5;
+    watch.reset();
+    std::vector<std::unique_ptr<Model>> copies;
+    for (int i = 0; i < numCopies; ++i) {
+        copies.emplace_back(loaded.clone());
+        SimTK::State copyState = copies.back()->initSystem();
+        CHECK(countMeshDecorations(*copies.back(), copyState) == numBodies);
+    }
+    const double copiesTime = watch.getElapsedTime();
+
+    int numVertices = 0;
+    for (const auto& file : meshFiles) {
+        numVertices += MeshFileCache::load(file)->getMesh().getNumVertices();
+    }
+    CHECK(MeshFileCache::getNumMeshes() == (int)meshFiles.size());
+    log_info("Loading and initializing a model with {} bone meshes took {} s "
+             "(without reading the meshes); visualizing it took {} s; "
+             "{} copies, initialized and visualized, took {} s. The {} "
+             "meshes in memory ({} vertices) are shared by all {} models.",
+            numBodies, startupTime, firstVisualizationTime, numCopies,
+            copiesTime, MeshFileCache::getNumMeshes(), numVertices,
+            numCopies + 1);
+}
@@ -0,0 +1,230 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: testModelSerialization.cpp                                        *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2022 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/catch.hpp>
+#include <OpenSim/Common/LoadOpenSimLibrary.h>
+#include <OpenSim/Common/Stopwatch.h>
+#include <OpenSim/Common/XMLDocument.h>
+#include <OpenSim/Simulation/osimSimulation.h>
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+#ifndef _WIN32
+    #include <sys/stat.h>
+#endif
+
+using namespace OpenSim;
+
+namespace {
+std::string readFile(const std::string& fileName) {
+    std::ifstream file(fileName);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+// Write the model using the XML document built by Object::updateXMLNode(),
+// as Object::print() did before it streamed the XML.
+void printUsingXMLDocument(const Model& model, const std::string& fileName) {
+    XMLDocument doc;
+    SimTK::Xml::Element root = doc.getRootElement();
+    model.updateXMLNode(root);
+    doc.print(fileName);
+}
+} // anonymous namespace
+
+TEST_CASE("Streamed model file matches the XML document") {
+    LoadOpenSimLibrary("osimActuators");
+    const auto modelFile =
+            GENERATE(as<std::string>{}, "gait2354_simbody.osim",
+                    "arm26.osim", "knee_patella_ligament.osim",
+                    "PushUpToesOnGroundWithMuscles.osim");
+    CAPTURE(modelFile);
+    Model model(modelFile);
+    model.finalizeFromProperties();
+
+    const auto serializeAllDefaults = GENERATE(false, true);
+    CAPTURE(serializeAllDefaults);
+    Object::setSerializeAllDefaults(serializeAllDefaults);
+    model.print("streamed_" + modelFile);
+    printUsingXMLDocument(model, "document_" + modelFile);
+    Object::setSerializeAllDefaults(false);
+
+    CHECK(readFile("streamed_" + modelFile) ==
+            readFile("document_" + modelFile));
+}
+
+TEST_CASE("Failed print does not overwrite the model file") {
+    LoadOpenSimLibrary("osimActuators");
+    Model model("arm26.osim");
+    const std::string fileName = "failed_print_arm26.osim";
+    // An unrelated file with the name of a temporary file is left alone.
+    std::ofstream(fileName + ".tmp") << "unrelated";
+    model.print(fileName);
+    const std::string contents = readFile(fileName);
+    CHECK(readFile(fileName + ".tmp") == "unrelated");
+
+    // Writing the offline ForceSet file fails partway through the model.
+    model.updForceSet().setInlined(false, "missing_directory/forces.xml");
+    model.setName("edited");
+    CHECK_THROWS_AS(model.print(fileName), Exception);
+    CHECK(readFile(fileName) == contents);
+    CHECK(readFile(fileName + ".tmp") == "unrelated");
+}
+
+#ifndef _WIN32
+TEST_CASE("Print keeps the permissions of the model file") {
+    Model model;
+    const std::string fileName = "print_permissions.osim";
+    model.print(fileName);
+    chmod(fileName.c_str(), 0640);
+    model.print(fileName);
+    struct stat info;
+    REQUIRE(stat(fileName.c_str(), &info) == 0);
+    CHECK((info.st_mode & 0777) == 0640);
+}
+#endif
+
+TEST_CASE("Model print benchmark", "[.benchmark]") {
+    // Streaming the XML (Object::print()) vs. building the XML document first.
+    LoadOpenSimLibrary("osimActuators");
+    const auto modelFile =
+            GENERATE(as<std::string>{}, "gait2354_simbody.osim",
+                    "PushUpToesOnGroundWithMuscles.osim");
+    Model model(modelFile);
+    model.finalizeFromProperties();
+
+    const int numPrints = 20;
+    Stopwatch watch;
+    for (int i = 0; i < numPrints; ++i) {
+        model.print("benchmark_streamed_" + modelFile);
+    }
+    const double streamedTime = watch.getElapsedTime();
+    watch.reset();
+    for (int i = 0; i < numPrints; ++i) {
+        printUsingXMLDocument(model, "benchmark_document_" + modelFile);
+    }
+    const double documentTime = watch.getElapsedTime();
+
+    CHECK(readFile("benchmark_streamed_" + modelFile) ==
+            readFile("benchmark_document_" + modelFile));
+    log_info("{}: {} prints took {} s streamed and {} s with the XML "
+             "document ({} ms vs. {} ms per print).",
+            modelFile, numPrints, streamedTime, documentTime,
+            1e3 * streamedTime / numPrints, 1e3 * documentTime / numPrints);
+}
+
+TEST_CASE("Reading a model file at the latest version") {
+    // Files at the latest version are read with an index of each element's
+    // children, while older files search the children for each property.
+    // Writing the model back out must reproduce the file exactly.
+    LoadOpenSimLibrary("osimActuators");
+    const auto modelFile =
+            GENERATE(as<std::string>{}, "gait2354_simbody.osim",
+                    "arm26.osim", "knee_patella_ligament.osim",
+                    "PushUpToesOnGroundWithMuscles.osim");
+    CAPTURE(modelFile);
+    Model legacy(modelFile);
+    legacy.print("latest_" + modelFile);
+
+    Model latest("latest_" + modelFile);
+    REQUIRE(latest.getDocumentFileVersion() ==
+            XMLDocument::getLatestVersion());
+    latest.print("latest_roundtrip_" + modelFile);
+    CHECK(readFile("latest_roundtrip_" + modelFile) ==
+            readFile("latest_" + modelFile));
+}
+
+TEST_CASE("Model load benchmark", "[.benchmark]") {
+    // The model files are first updated to the latest version.
+    LoadOpenSimLibrary("osimActuators");
+    const auto modelFile =
+            GENERATE(as<std::string>{}, "gait2354_simbody.osim",
+                    "PushUpToesOnGroundWithMuscles.osim");
+    const std::string latestFile = "benchmark_latest_" + modelFile;
+    Model legacy(modelFile);
+    legacy.print(latestFile);
+
+    const int numLoads = 10;
+    Stopwatch watch;
+    for (int i = 0; i < numLoads; ++i) {
+        Model model(latestFile);
+        CHECK(model.getNumBodies() > 0);
+    }
+    const double elapsed = watch.getElapsedTime();
+    log_info("{}: {} loads of a {}-byte file took {} s ({} ms per load).",
+            latestFile, numLoads, readFile(latestFile).size(), elapsed,
+            1e3 * elapsed / numLoads);
+}
+
+TEST_CASE("Reading object lists in parallel") {
+    // The objects in long lists (e.g., the muscles in the ForceSet) may be
+    // read on multiple threads; the model must be the same as when all
+    // objects are read on one thread.
+    LoadOpenSimLibrary("osimActuators");
+    const auto modelFile =
+            GENERATE(as<std::string>{}, "gait2354_simbody.osim",
+                    "PushUpToesOnGroundWithMuscles.osim");
+    CAPTURE(modelFile);
+    const std::string latestFile = "threads_latest_" + modelFile;
+    Model legacy(modelFile);
+    legacy.print(latestFile);
+
+    // Reading on multiple threads is opt-in.
+    const int defaultNumThreads = Object::getNumThreadsForReadingXML();
+    CHECK(defaultNumThreads == 1);
+    Model serial(latestFile);
+    serial.print("threads_serial_" + modelFile);
+    Object::setNumThreadsForReadingXML(4);
+    Model parallel(latestFile);
+    parallel.print("threads_parallel_" + modelFile);
+    Object::setNumThreadsForReadingXML(defaultNumThreads);
+
+    CHECK(readFile("threads_parallel_" + modelFile) ==
+            readFile("threads_serial_" + modelFile));
+    CHECK_THROWS_AS(Object::setNumThreadsForReadingXML(-1), Exception);
+}
+
+TEST_CASE("Parallel model load benchmark", "[.benchmark]") {
+    // Object lists read on one thread vs. on all hardware threads.
+    LoadOpenSimLibrary("osimActuators");
+    const auto modelFile =
+            GENERATE(as<std::string>{}, "gait2354_simbody.osim",
+                    "PushUpToesOnGroundWithMuscles.osim");
+    const std::string latestFile = "benchmark_threads_" + modelFile;
+    Model legacy(modelFile);
+    legacy.print(latestFile);
+
+    const int defaultNumThreads = Object::getNumThreadsForReadingXML();
+    const int numLoads = 10;
+    double elapsed[2];
+    for (int numThreads : {1, 0}) {
+        Object::setNumThreadsForReadingXML(numThreads);
+        Stopwatch watch;
+        for (int i = 0; i < numLoads; ++i) {
+            Model model(latestFile);
+            CHECK(model.getNumBodies() > 0);
+        }
+        elapsed[numThreads == 0] = watch.getElapsedTime();
+    }
+    Object::setNumThreadsForReadingXML(defaultNumThreads);
+    log_info("{}: {} loads took {} s on one thread and {} s on {} threads "
+             "({} ms vs. {} ms per load).",
+            latestFile, numLoads, elapsed[0], elapsed[1],
+            std::thread::hardware_concurrency(), 1e3 * elapsed[0] / numLoads,
+            1e3 * elapsed[1] / numLoads);
+}
@@ -0,0 +1,109 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: testMovingPathPoint.cpp                                           *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2022 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/auxiliaryTestSimulationFunctions.h>
+#include <OpenSim/Auxiliary/catch.hpp>
+#include <OpenSim/Common/LoadOpenSimLibrary.h>
+#include <OpenSim/Common/Stopwatch.h>
+#include <OpenSim/Simulation/osimSimulation.h>
+
+#include <algorithm>
+
+using namespace OpenSim;
+
+TEST_CASE("MovingPathPoint location and derivatives") {
+    // The cached location and derivatives must match evaluating the location
+    // functions directly, and must be updated when the coordinate changes.
+    LoadOpenSimLibrary("osimActuators");
+    Model model("gait2354_simbody.osim");
+    SimTK::State state = model.initSystem();
+    SimTK::Random::Uniform random(0, 1);
+    random.setSeed(0);
+
+    const auto points = model.getComponentList<MovingPathPoint>();
+    REQUIRE(points.begin() != points.end());
+    for (int itrial = 0; itrial < 20; ++itrial) {
+        // Values outside of the ranges exercise the clamping of the location.
+        randomizeCoordinates(model, state, random, 0.1);
+        model.realizeVelocity(state);
+        for (const auto& point : points) {
+            CAPTURE(point.getAbsolutePathString());
+            const Coordinate& coord = point.getXCoordinate();
+            const double value = coord.getValue(state);
+            const double clamped = SimTK::clamp(
+                    coord.getRangeMin(), value, coord.getRangeMax());
+            const Function* functions[3] = {&point.get_x_location(),
+                    &point.get_y_location(), &point.get_z_location()};
+            const SimTK::Vec3 location = point.getLocation(state);
+            const SimTK::Vec3 dPdq = point.getdPointdQ(state);
+            const SimTK::Vec3 velocity = point.getVelocity(state);
+            for (int i = 0; i < 3; ++i) {
+                const double expectedLocation =
+                        functions[i]->calcValue(SimTK::Vector(1, clamped));
+                const double expectedDeriv = functions[i]->calcDerivative(
+                        {0}, SimTK::Vector(1, value));
+                CHECK(location[i] == Approx(expectedLocation).epsilon(1e-12));
+                CHECK(dPdq[i] == Approx(expectedDeriv).epsilon(1e-12));
+                CHECK(velocity[i] ==
+                        Approx(expectedDeriv * coord.getSpeedValue(state))
+                                .epsilon(1e-12));
+            }
+        }
+    }
+}
+
+TEST_CASE("Path kinematics benchmark", "[.benchmark]") {
+    // Both models have moving path points at the knee.
+    LoadOpenSimLibrary("osimActuators");
+    const auto modelFile =
+            GENERATE(as<std::string>{}, "gait2354_simbody.osim",
+                    "PushUpToesOnGroundWithMuscles.osim");
+    Model model(modelFile);
+    SimTK::State state = model.initSystem();
+
+    // The coordinates that the moving path points depend on.
+    std::vector<const Coordinate*> coords;
+    for (const auto& point : model.getComponentList<MovingPathPoint>()) {
+        const Coordinate* coord = &point.getXCoordinate();
+        if (std::find(coords.begin(), coords.end(), coord) == coords.end()) {
+            coords.push_back(coord);
+        }
+    }
+
+    SimTK::Random::Uniform random(0, 1);
+    random.setSeed(0);
+    const int numEvaluations = 50;
+    double sum = 0;
+    Stopwatch watch;
+    for (int i = 0; i < numEvaluations; ++i) {
+        randomizeCoordinates(model, state, random, 0.1);
+        model.realizeVelocity(state);
+        for (const auto& actu : model.getComponentList<PathActuator>()) {
+            const GeometryPath& path = actu.getGeometryPath();
+            sum += path.getLength(state) + path.getLengtheningSpeed(state);
+            for (const auto* coord : coords) {
+                sum += path.computeMomentArm(state, *coord);
+            }
+        }
+    }
+    const double elapsed = watch.getElapsedTime();
+    CHECK(SimTK::isFinite(sum));
+    log_info("{}: {} path kinematics evaluations took {} ({} ms per "
+             "evaluation).",
+            modelFile, numEvaluations, watch.getElapsedTimeFormatted(),
+            1e3 * elapsed / numEvaluations);
+}
@@ -25,6 +25,7 @@
 #include <OpenSim/Common/LogSink.h>
 #include <OpenSim/Common/Logger.h>
 #include <OpenSim/Common/Reporter.h>
+#include <OpenSim/Common/Stopwatch.h>
 #include <OpenSim/Simulation/Manager/Manager.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/SimbodyEngine/SliderJoint.h>
@@ -116,9 +117,66 @@ void testTableReporterLabels() {
     SimTK_TEST(headings[1] == "height");
 }
 
+void testTableReporterRequiredStage() {
+    // Create a model consisting of a falling ball.
+    Model model;
+    model.setName("world");
+
+    auto* ball = new OpenSim::Body("ball", 1., Vec3(0), Inertia(0));
+    model.addBody(ball);
+
+    auto* slider = new SliderJoint("slider", model.getGround(), Vec3(0),
+        Vec3(0,0,Pi/2.), *ball, Vec3(0), Vec3(0,0,Pi/2.));
+    model.addJoint(slider);
+
+    // This reporter only reports Position-stage outputs.
+    auto* positionReporter = new TableReporterVec3();
+    positionReporter->setName("position_reporter");
+    positionReporter->set_report_time_interval(0.001);
+    positionReporter->addToReport(model.getOutput("com_position"));
+    model.addComponent(positionReporter);
+
+    // This reporter also reports an Acceleration-stage output.
+    auto* accelerationReporter = new TableReporterVec3();
+    accelerationReporter->setName("acceleration_reporter");
+    accelerationReporter->set_report_time_interval(0.001);
+    accelerationReporter->addToReport(model.getOutput("com_position"));
+    accelerationReporter->addToReport(model.getOutput("com_acceleration"));
+    model.addComponent(accelerationReporter);
+
+    // Before connections are finalized, the reporters assume the worst.
+    SimTK_TEST(positionReporter->getRequiredStage() == Stage::Report);
+
+    State& state = model.initSystem();
+    SimTK_TEST(positionReporter->getRequiredStage() == Stage::Position);
+    SimTK_TEST(accelerationReporter->getRequiredStage() ==
+               Stage::Acceleration);
+
+    // Simulate for a long time with a small report interval and report the
+    // time spent.
+    Manager manager(model);
+    state.setTime(0.0);
+    manager.initialize(state);
+    Stopwatch watch;
+    manager.integrate(10.0);
+    const auto& positionTable = positionReporter->getTable();
+    const auto& accelerationTable = accelerationReporter->getTable();
+    cout << "Simulated 10 s with 2 x " << positionTable.getNumRows()
+         << " reports in " << watch.getElapsedTimeFormatted() << endl;
+
+    SimTK_TEST(positionTable.getNumRows() >= 10000);
+    SimTK_TEST(positionTable.getNumRows() == accelerationTable.getNumRows());
+    // Realizing only to Position must not change the reported values.
+    for (int i = 0; i < (int)positionTable.getNumRows(); i += 1000) {
+        SimTK_TEST_EQ(positionTable.getRowAtIndex(i)[0],
+                      accelerationTable.getRowAtIndex(i)[0]);
+    }
+}
+
 int main() {
     SimTK_START_TEST("testReporters");
         SimTK_SUBTEST(testConsoleReporterLabels);
         SimTK_SUBTEST(testTableReporterLabels);
+        SimTK_SUBTEST(testTableReporterRequiredStage);
     SimTK_END_TEST();
 };
@@ -24,6 +24,24 @@
 
 using namespace OpenSim;
 
+namespace {
+class CountingTableOperator : public TableOperator {
+    OpenSim_DECLARE_CONCRETE_OBJECT(CountingTableOperator, TableOperator);
+
+public:
+    OpenSim_DECLARE_PROPERTY(scale, double, "Scale the table by this factor.");
+    CountingTableOperator(double scale = 1.0) {
+        constructProperty_scale(scale);
+    }
+    void operate(TimeSeriesTable& table, const Model*) const override {
+        ++numCalls;
+        table.updMatrix() *= get_scale();
+    }
+    static int numCalls;
+};
+int CountingTableOperator::numCalls = 0;
+} // anonymous namespace
+
 TEST_CASE("TableProcessor") {
     Object::registerType(TableProcessor());
 
@@ -75,4 +93,60 @@ TEST_CASE("TableProcessor") {
             CHECK(out.getNumRows() == 4);
         }
     }
+
+    SECTION("Memoization") {
+        Object::registerType(CountingTableOperator());
+        STOFileAdapter::write(table, "testTableProcessor_memo.sto");
+        TableProcessor::clearMemoizedTables();
+        TableProcessor::setMemoizationEnabled(true);
+        CountingTableOperator::numCalls = 0;
+        TableProcessor proc = TableProcessor("testTableProcessor_memo.sto") |
+                              CountingTableOperator(2.0);
+
+        // The second call reuses the memoized table.
+        const TimeSeriesTable first = proc.process();
+        const TimeSeriesTable second = proc.process();
+        CHECK(CountingTableOperator::numCalls == 1);
+        CHECK(second.getNumRows() == first.getNumRows());
+        CHECK(SimTK::Test::numericallyEqual(
+                second.getMatrix(), first.getMatrix(), 1, 1e-12));
+
+        // Editing an operator changes the key.
+        {
+            TableProcessor proc3 =
+                    TableProcessor("testTableProcessor_memo.sto") |
+                    CountingTableOperator(3.0);
+            const TimeSeriesTable third = proc3.process();
+            CHECK(CountingTableOperator::numCalls == 2);
+            CHECK(third.getMatrix()(0, 0) ==
+                    Approx(1.5 * first.getMatrix()(0, 0)));
+        }
+
+        // Editing the source file changes the key.
+        {
+            TimeSeriesTable edited = table;
+            edited.updMatrix() *= 10.0;
+            STOFileAdapter::write(edited, "testTableProcessor_memo.sto");
+            const TimeSeriesTable fromEdited = proc.process();
+            CHECK(CountingTableOperator::numCalls == 3);
+            CHECK(fromEdited.getMatrix()(0, 0) ==
+                    Approx(10.0 * first.getMatrix()(0, 0)));
+        }
+
+        // Tables in the memoization directory are reused after the in-memory
+        // memo is cleared.
+        TableProcessor::setMemoizationDirectory(".");
+        proc.process();
+        CHECK(CountingTableOperator::numCalls == 4);
+        TableProcessor::clearMemoizedTables();
+        proc.process();
+        CHECK(CountingTableOperator::numCalls == 4);
+
+        // Memoization is disabled by default.
+        TableProcessor::setMemoizationDirectory("");
+        TableProcessor::setMemoizationEnabled(false);
+        TableProcessor::clearMemoizedTables();
+        proc.process();
+        CHECK(CountingTableOperator::numCalls == 5);
+    }
 }
@@ -37,6 +37,7 @@
 #include "Model/ContactGeometrySet.h"
 #include "Model/ContactHalfSpace.h"
 #include "Model/ContactMesh.h"
+#include "Model/MeshFileCache.h"
 #include "Model/ContactSphere.h"
 #include "Model/CoordinateSet.h"
 #include "Model/ElasticFoundationForce.h"
@@ -126,6 +127,7 @@
 #include "StatesTrajectoryReporter.h"
 #include "TableProcessor.h"
 #include "PositionMotion.h"
+#include "OpenSense/CompactOrientationsTable.h"
 #include "OpenSense/OpenSenseUtilities.h"
 #include "OpenSense/IMU.h"
 #include "SimulationUtilities.h"
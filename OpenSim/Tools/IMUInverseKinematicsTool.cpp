@@ -137,13 +137,14 @@ void IMUInverseKinematicsTool::runInverseKinematicsWithOrientationsFromFile(
             rotations[0], SimTK::XAxis, rotations[1], SimTK::YAxis, 
             rotations[2], SimTK::ZAxis);
 
-    // Rotate data so Y-Axis is up
-    OpenSenseUtilities::rotateOrientationTable(quatTable, sensorToOpenSim);
-    //Trim to time window required by Tool
-    quatTable.trim(getStartTime(), getEndTime());
+    // Rotate data so Y-Axis is up. The orientations are rotated and converted
+    // in a compact layout, which is faster for long trials; quatTable is no
+    // longer needed, so its data is released.
+    CompactOrientationsTable orientations(std::move(quatTable));
+    orientations.rotate(sensorToOpenSim);
 
     TimeSeriesTable_<SimTK::Rotation> orientationsData =
-        OpenSenseUtilities::convertQuaternionsToRotations(quatTable);
+        orientations.convertToRotationsTable();
 
     OrientationsReference oRefs(orientationsData, &get_orientation_weights());
 
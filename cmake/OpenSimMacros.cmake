@@ -329,6 +329,10 @@ endfunction()
 # LINKLIBS: Arguments to TARGET_LINK_LIBRARIES.
 # SOURCES: Extra source files for the executable.
 #
+# Catch TEST_CASEs that only time code (benchmarks) are tagged "[.benchmark]";
+# the leading "." hides them from the test run, and they are run with
+# `<test program> [.benchmark]`.
+#
 # Here's an example:
 #   file(GLOB TEST_PROGRAMS "test*.cpp")
 #   file(GLOB DATA_FILES *.osim *.xml *.sto *.mot)